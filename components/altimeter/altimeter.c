@@ -19,6 +19,7 @@
 
 #include <time.h>
 #include <sys/time.h>
+#include <math.h>
 
 #include "badge.h"
 #include "badge_pins.h"
@@ -36,13 +37,19 @@
 
 #include "epaper_fonts.h"
 #include "epaper-29-dke.h"
-#include "imagedata.h"
+#include "images.h"
+#include "backgrounds.h"
 #include <string.h>
 
 static const char* TAG = "Altimeter";
 
 #define WEATHER_DATA_RETREIVAL_TIMEOUT      5
 #define HEART_RATE_RETREIVAL_TIMEOUT        3
+// Period of checking for data retrieved in background [ms]
+#define RETREIVAL_POLL_PERIOD             100
+
+// Number of fast partial display refreshes between full refreshes that clear ghosting
+#define DISPLAY_FULL_REFRESH_INTERVAL      12
 
 led line[6] = {0};
 
@@ -77,6 +84,42 @@ RTC_DATA_ATTR altitude_data altitude_record = {0};
 RTC_DATA_ATTR int climb_count_state = CLIMB_COUNT_STATE_START;
 RTC_DATA_ATTR static float altitude_last_for_climb_count; // last measurement for climb count calculation
 
+#if CONFIG_ALTITUDE_ADAPTIVE_SAMPLING
+// Latest altitude samples to estimate vertical speed, retained during deep sleep
+#define ALTITUDE_SAMPLES    16
+
+typedef struct {
+    uint32_t time_ms;  // module time of the sample, differences of which are valid when it wraps
+    float altitude;
+} altitude_sample;
+
+RTC_DATA_ATTR static altitude_sample altitude_samples[ALTITUDE_SAMPLES];
+RTC_DATA_ATTR static unsigned long altitude_sample_count; // samples added, the latest one at (count - 1) % ALTITUDE_SAMPLES
+RTC_DATA_ATTR static int sampling_period; // [s] adapted to vertical speed, 0 before the first sample
+#endif
+
+// Charts of the latest altitude and heart rate samples shown on screen 5,
+// one column per sample, retained during deep sleep together with their plots
+#define CHART_WIDTH             192
+#define CHART_HEIGHT             48
+// Altitude range of the chart [m], it starts over around the altitude that leaves it
+#define ALTITUDE_CHART_RANGE    200
+#define HEART_RATE_CHART_MIN     40
+#define HEART_RATE_CHART_MAX    200
+
+RTC_DATA_ATTR static epaper_chart_t altitude_chart;
+RTC_DATA_ATTR static epaper_chart_t heart_rate_chart;
+RTC_DATA_ATTR static uint8_t altitude_plot[EPAPER_CHART_PLOT_SIZE(CHART_WIDTH, CHART_HEIGHT)];
+RTC_DATA_ATTR static uint8_t heart_rate_plot[EPAPER_CHART_PLOT_SIZE(CHART_WIDTH, CHART_HEIGHT)];
+RTC_DATA_ATTR static unsigned long chart_samples; // samples added to any chart
+
+// Heart rate samples received by the BLE callback, which may run at any time until deep sleep,
+// they are added to the chart by the display job, so the chart does not change while it is drawn
+#define HEART_RATE_PENDING_MAX   16
+RTC_DATA_ATTR static int heart_rate_pending[HEART_RATE_PENDING_MAX];
+RTC_DATA_ATTR static int heart_rate_pending_count;
+static portMUX_TYPE heart_rate_pending_mux = portMUX_INITIALIZER_UNLOCKED;
+
 epaper_handle_t display_device = NULL;
 
 epaper_conf_t epaper_conf = {
@@ -100,6 +143,12 @@ epaper_conf_t epaper_conf = {
     .width = EPD_WIDTH,
     .height = EPD_HEIGHT,
     .color_inv = 1,
+    // the display is put into deep sleep: warm start would save about 12 ms of
+    // a wake up with a refresh, standby current of the panel is not measured yet
+    .warm_start = false,
+    // drawing is replayed into a strip of 16 rows instead of a whole frame buffer,
+    // backgrounds are in flash and charts in RTC memory, so they are kept until displayed
+    .band_rows = 16,
 };
 
 void update_to_now(unsigned long* time)
@@ -126,6 +175,21 @@ void leds_task(void *pvParameter)
     }
 }
 
+/* Wait until a callback updates 'time' from 'last_update', checking often,
+ * so the wake up ends soon after the data is retrieved
+ * Returns false if there is no update within 'timeout' seconds.
+ */
+static bool wait_for_update(volatile unsigned long* time, unsigned long last_update, int timeout)
+{
+    for (int waited = 0; waited < timeout * 1000; waited += RETREIVAL_POLL_PERIOD) {
+        if (*time != last_update) {
+            return true;
+        }
+        vTaskDelay(RETREIVAL_POLL_PERIOD / portTICK_RATE_MS);
+    }
+    return *time != last_update;
+}
+
 static void weather_data_retreived(uint32_t *args)
 {
     weather_data* weather = (weather_data*) args;
@@ -151,30 +215,22 @@ void update_reference_pressure(void){
     on_weather_data_retrieval(weather_data_retreived);
     ESP_LOGI(TAG, "Weather data retrieval initialized");
 
-    int count_down = WEATHER_DATA_RETREIVAL_TIMEOUT;
     ESP_LOGI(TAG, "Waiting for reference pressure update...");
-    while (reference_pressure_update.time == last_update) {
-        ESP_LOGI(TAG, "Waiting %d", count_down);
-        vTaskDelay(1000 / portTICK_RATE_MS);
-        if (reference_pressure_update.time != last_update) {
-            ESP_LOGI(TAG, "Update received");
-            reference_pressure_update.result = ESP_OK;
-            line[REF_PRESSURE_RETREIEVAL_LED_INDEX].green = LED_OFF;
-            break;
-        }
-        if (--count_down == 0) {
-            if (altitude_record.reference_pressure == 0) {
-                altitude_record.reference_pressure = 101325l;
-                // thingspeak_update.time is set in callback
-                ESP_LOGW(TAG, "Assumed standard pressure at the sea level");
-            }
-            reference_pressure_update.failures++;
-            reference_pressure_update.result = ! ESP_OK;
-            ESP_LOGW(TAG, "Exit waiting");
-            line[REF_PRESSURE_RETREIEVAL_LED_INDEX].green = LED_OFF;
-            line[REF_PRESSURE_RETREIEVAL_LED_INDEX].red = LED_ON_MED;
-            break;
+    if (wait_for_update(&reference_pressure_update.time, last_update, WEATHER_DATA_RETREIVAL_TIMEOUT)) {
+        ESP_LOGI(TAG, "Update received");
+        reference_pressure_update.result = ESP_OK;
+        line[REF_PRESSURE_RETREIEVAL_LED_INDEX].green = LED_OFF;
+    } else {
+        if (altitude_record.reference_pressure == 0) {
+            altitude_record.reference_pressure = 101325l;
+            // thingspeak_update.time is set in callback
+            ESP_LOGW(TAG, "Assumed standard pressure at the sea level");
         }
+        reference_pressure_update.failures++;
+        reference_pressure_update.result = ! ESP_OK;
+        ESP_LOGW(TAG, "Exit waiting");
+        line[REF_PRESSURE_RETREIEVAL_LED_INDEX].green = LED_OFF;
+        line[REF_PRESSURE_RETREIEVAL_LED_INDEX].red = LED_ON_MED;
     }
 }
 
@@ -208,6 +264,14 @@ static void heart_rate_data_retreived(uint32_t *args)
     heart_rate_data* heart_rate_sensor = (heart_rate_data*) args;
     altitude_record.heart_rate = heart_rate_sensor->heart_rate;
     update_to_now(&heart_rate_update.time);
+    portENTER_CRITICAL(&heart_rate_pending_mux);
+    if (heart_rate_pending_count == HEART_RATE_PENDING_MAX) {
+        // the oldest sample is dropped
+        memmove(heart_rate_pending, heart_rate_pending + 1, sizeof(heart_rate_pending) - sizeof(heart_rate_pending[0]));
+        heart_rate_pending_count--;
+    }
+    heart_rate_pending[heart_rate_pending_count++] = altitude_record.heart_rate;
+    portEXIT_CRITICAL(&heart_rate_pending_mux);
     ESP_LOGI(TAG, "Heart rate: %d BPM", altitude_record.heart_rate);
 }
 
@@ -230,29 +294,96 @@ void update_heart_rate(void){
             line[HEART_RATE_UPDATE_LED_INDEX].red = LED_ON_MED;
         }
 
-        int count_down = HEART_RATE_RETREIVAL_TIMEOUT;
         ESP_LOGI(TAG, "Waiting for heart rate update ...");
-        while (1) {
-            ESP_LOGI(TAG, "Waiting %d ...", count_down);
-            vTaskDelay(1000 / portTICK_RATE_MS);
-            if (heart_rate_update.time > last_update) {
-                heart_rate_update.result = ESP_OK;
-                line[HEART_RATE_UPDATE_LED_INDEX].blue = LED_OFF;
-                ESP_LOGI(TAG, "Update received");
-                break;
-            }
-            if (--count_down == 0) {
-                heart_rate_update.failures++;
-                heart_rate_update.result = ! ESP_OK;
-                ESP_LOGW(TAG, "Exit waiting");
-                line[HEART_RATE_UPDATE_LED_INDEX].blue = LED_OFF;
-                line[HEART_RATE_UPDATE_LED_INDEX].red = LED_ON_MED;
-                break;
-            }
+        if (wait_for_update(&heart_rate_update.time, last_update, HEART_RATE_RETREIVAL_TIMEOUT)) {
+            heart_rate_update.result = ESP_OK;
+            line[HEART_RATE_UPDATE_LED_INDEX].blue = LED_OFF;
+            ESP_LOGI(TAG, "Update received");
+        } else {
+            heart_rate_update.failures++;
+            heart_rate_update.result = ! ESP_OK;
+            ESP_LOGW(TAG, "Exit waiting");
+            line[HEART_RATE_UPDATE_LED_INDEX].blue = LED_OFF;
+            line[HEART_RATE_UPDATE_LED_INDEX].red = LED_ON_MED;
         }
     }
 }
 
+#if CONFIG_ALTITUDE_ADAPTIVE_SAMPLING
+static const altitude_sample* latest_altitude_sample(unsigned long age)
+{
+    return &altitude_samples[(altitude_sample_count - 1 - age) % ALTITUDE_SAMPLES];
+}
+
+// Vertical speed [m/s] fitted by least squares to samples within CONFIG_ALTITUDE_SPEED_WINDOW
+// before the latest one, and at least to the latest two
+static float vertical_speed(void)
+{
+    unsigned long count = altitude_sample_count < ALTITUDE_SAMPLES ? altitude_sample_count : ALTITUDE_SAMPLES;
+    uint32_t latest_ms = latest_altitude_sample(0)->time_ms;
+    float st = 0, sa = 0, stt = 0, sta = 0;
+    int n = 0;
+
+    for (unsigned long age = 0; age < count; age++) {
+        const altitude_sample* sample = latest_altitude_sample(age);
+        float t = -(float) (uint32_t) (latest_ms - sample->time_ms) / 1000;
+        if (n >= 2 && t < -CONFIG_ALTITUDE_SPEED_WINDOW) {
+            break;
+        }
+        // altitude relative to the latest one keeps precision of floats
+        float a = sample->altitude - latest_altitude_sample(0)->altitude;
+        st += t;
+        sa += a;
+        stt += t * t;
+        sta += t * a;
+        n++;
+    }
+    float d = n * stt - st * st;
+    if (n < 2 || d <= 0) {
+        return 0;
+    }
+    return (n * sta - st * sa) / d;
+}
+
+// Keep the sampling period short during a climb or descent, double it with each flat sample
+static void adapt_sampling_period(void)
+{
+    struct timeval module_time;
+    gettimeofday(&module_time, NULL);
+
+    altitude_samples[altitude_sample_count % ALTITUDE_SAMPLES] = (altitude_sample) {
+        .time_ms = (uint32_t) module_time.tv_sec * 1000 + module_time.tv_usec / 1000,
+        .altitude = altitude_record.altitude,
+    };
+    altitude_sample_count++;
+
+    float speed = vertical_speed();
+    float step = 0;
+    if (altitude_sample_count >= 2) {
+        step = latest_altitude_sample(0)->altitude - latest_altitude_sample(1)->altitude;
+    }
+    if (sampling_period == 0 || fabsf(speed) * 100 >= CONFIG_ALTITUDE_CLIMB_SPEED
+            || fabsf(step) >= CONFIG_ALTITUDE_CLIMB_STEP) {
+        sampling_period = CONFIG_ALTITUDE_ACTIVE_PERIOD;
+    } else if (sampling_period < CONFIG_ALTITUDE_IDLE_PERIOD_MAX) {
+        sampling_period *= 2;
+        if (sampling_period > CONFIG_ALTITUDE_IDLE_PERIOD_MAX) {
+            sampling_period = CONFIG_ALTITUDE_IDLE_PERIOD_MAX;
+        }
+    }
+    ESP_LOGI(TAG, "Vertical speed %0.2f m/s, sampling period %d s", speed, sampling_period);
+}
+#endif
+
+int altitude_sampling_period(void)
+{
+#if CONFIG_ALTITUDE_ADAPTIVE_SAMPLING
+    return sampling_period;
+#else
+    return 0;
+#endif
+}
+
 void measure_altitude(void)
 {
     esp_err_t err;
@@ -308,6 +439,17 @@ void measure_altitude(void)
     update_to_now(&altitude_update.time);
 
     ESP_LOGI(TAG, "Absolute altitude %0.1f m", altitude_record.altitude);
+#if CONFIG_ALTITUDE_ADAPTIVE_SAMPLING
+    adapt_sampling_period();
+#endif
+
+    int chart_altitude = (int) altitude_record.altitude;
+    if (altitude_chart.plot == NULL || chart_altitude < altitude_chart.min || chart_altitude > altitude_chart.max) {
+        iot_epaper_chart_init(&altitude_chart, altitude_plot, CHART_WIDTH, CHART_HEIGHT,
+                chart_altitude - ALTITUDE_CHART_RANGE / 2, chart_altitude + ALTITUDE_CHART_RANGE / 2);
+    }
+    iot_epaper_chart_add(&altitude_chart, chart_altitude);
+    chart_samples++;
 
     float altitude_delta = altitude_record.altitude - altitude_last;
     if (altitude_delta > ALTITUDE_DISRIMINATION) {
@@ -378,222 +520,395 @@ void init_display()
     if (display_init_done == false) {
         display_device = iot_epaper_create(NULL, &epaper_conf);
         iot_epaper_set_rotate(display_device, E_PAPER_ROTATE_270);
+        iot_epaper_set_refresh_mode(display_device, E_PAPER_REFRESH_PARTIAL);
+        iot_epaper_set_full_refresh_interval(display_device, DISPLAY_FULL_REFRESH_INTERVAL);
         display_init_done = true;
     }
 }
 
+/* Icons in OK state and separation lines are in the screen backgrounds,
+ * see tools/screen_backgrounds.c, so only failed icons are drawn here
+ */
 void show_status_line(){
 
-    bool failure_state;  // false == OK
-
     // Climbing Icon
-    failure_state = altitude_update.result;
-    if (failure_state) {
+    if (altitude_update.result) {
         iot_epaper_draw_filled_rectangle(display_device, 34, 0, 58, 17, COLORED);
-    } else {
-        iot_epaper_draw_rectangle(display_device, 34, 0, 58, 17, COLORED);
+        iot_epaper_draw_string(display_device,  35,  2, "/\\", &epaper_font_16, UNCOLORED);
     }
-    iot_epaper_draw_string(display_device,  35,  2, "/\\", &epaper_font_16, failure_state ? UNCOLORED : COLORED);
 
     // Wi-Fi Icon
-    failure_state = wifi_connection.result;
-    if (failure_state) {
+    if (wifi_connection.result) {
         iot_epaper_draw_filled_rectangle(display_device, 82, 0, 122, 12, COLORED);
-    } else {
-        iot_epaper_draw_rectangle(display_device, 82, 0, 122, 12, COLORED);
+        iot_epaper_draw_string(display_device,  85,  1, "Wi-Fi", &epaper_font_12, UNCOLORED);
     }
-    iot_epaper_draw_string(display_device,  85,  1, "Wi-Fi", &epaper_font_12, failure_state ? UNCOLORED : COLORED);
 
     // Cloud Icon / ThingsSpeak
-    failure_state = thingspeak_update.result;
-    if (failure_state) {
+    if (thingspeak_update.result) {
         iot_epaper_draw_filled_rectangle(display_device, 138, 0, 177, 12, COLORED);
-    } else {
-        iot_epaper_draw_rectangle(display_device, 138, 0, 177, 12, COLORED);
+        iot_epaper_draw_string(display_device, 140,  1, "Cloud", &epaper_font_12, UNCOLORED);
     }
-    iot_epaper_draw_string(display_device, 140,  1, "Cloud", &epaper_font_12, failure_state ? UNCOLORED : COLORED);
 
     // RefP Icon / OpenWeatherMap
-    failure_state = reference_pressure_update.result;
-    if (failure_state) {
+    if (reference_pressure_update.result) {
         iot_epaper_draw_filled_rectangle(display_device, 202, 0, 234, 12, COLORED);
-    } else {
-        iot_epaper_draw_rectangle(display_device, 202, 0, 234, 12, COLORED);
+        iot_epaper_draw_string(display_device, 205,  1, "RefP", &epaper_font_12, UNCOLORED);
     }
-    iot_epaper_draw_string(display_device, 205,  1, "RefP", &epaper_font_12, failure_state ? UNCOLORED : COLORED);
 
     //
     // ToDo: add error tracking
     //
     // HRM Icon
-    failure_state = heart_rate_update.result;
-    if (failure_state) {
+    if (heart_rate_update.result) {
         iot_epaper_draw_filled_rectangle(display_device, 262, 0, 287, 12, COLORED);
-    } else {
-        iot_epaper_draw_rectangle(display_device, 262, 0, 287, 12, COLORED);
+        iot_epaper_draw_string(display_device, 265,  1, "HRM", &epaper_font_12, UNCOLORED);
+    }
+}
+
+/* Values and charts shown on screens 0 to 5, labels and lines are in the screen backgrounds
+ * Each value is formatted by its function into at most DISPLAY_TEXT_SIZE - 1
+ * characters, padded so values of any size end in the same column.
+ */
+#define DISPLAY_FIELDS_MAX      4
+#define DISPLAY_TEXT_SIZE      16
+
+typedef struct {
+    int x;
+    int y;
+    epaper_font_t* font;
+    void (*format)(char* text);
+} display_field_t;
+
+typedef struct {
+    int field_count;
+    display_field_t fields[DISPLAY_FIELDS_MAX];
+} display_screen_t;
+
+typedef struct {
+    int screen;
+    int x;
+    int y;
+    const epaper_chart_t* chart;
+} display_chart_t;
+
+// Screen and values on the display, retained during deep sleep
+// so an update that would show the same is skipped
+RTC_DATA_ATTR static int shown_screen = -1;
+RTC_DATA_ATTR static int shown_status;
+RTC_DATA_ATTR static char shown_text[DISPLAY_FIELDS_MAX][DISPLAY_TEXT_SIZE];
+RTC_DATA_ATTR static unsigned long shown_chart_samples;
+
+static void format_duration(char* text, unsigned long duration)
+{
+    int hours   = (int) (duration / 3600);
+    int minutes = (int) ((duration / 60) % 60);
+    int seconds = (int) (duration % 60);
+    snprintf(text, DISPLAY_TEXT_SIZE, "%2d:%02d:%02d", hours, minutes, seconds);
+}
+
+static void format_altitude_climbed(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6.0f m", altitude_record.altitude_climbed);
+}
+
+static void format_heart_rate(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6d BPM", altitude_record.heart_rate);
+}
+
+static void format_battery_voltage(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6.2f V", altitude_record.battery_voltage);
+}
+
+// Up time of the record is updated only when published, display runs concurrently
+static void format_up_time(char* text)
+{
+    unsigned long up_time;
+    update_to_now(&up_time);
+    format_duration(text, up_time);
+}
+
+static void format_climb_count_top(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%9d", altitude_record.climb_count_top);
+}
+
+static void format_time_per_climb(char* text)
+{
+    if (altitude_record.climb_count_top == 0) {
+        snprintf(text, DISPLAY_TEXT_SIZE, "%8s", "-");
+        return;
+    }
+    unsigned long up_time;
+    update_to_now(&up_time);
+    format_duration(text, up_time / altitude_record.climb_count_top);
+}
+
+static void format_floors_count(char* text)
+{
+    if (altitude_record.climb_count_top == 0) {
+        snprintf(text, DISPLAY_TEXT_SIZE, "%9s", "-");
+        return;
+    }
+    snprintf(text, DISPLAY_TEXT_SIZE, "%9d", altitude_record.climb_count_top * FLOORS_FOR_MER);
+}
+
+static void format_meters_count(char* text)
+{
+    if (altitude_record.climb_count_top == 0) {
+        snprintf(text, DISPLAY_TEXT_SIZE, "%9s", "-");
+        return;
     }
-    iot_epaper_draw_string(display_device, 265,  1, "HRM", &epaper_font_12, failure_state ? UNCOLORED : COLORED);
+    snprintf(text, DISPLAY_TEXT_SIZE, "%9d", (int) (altitude_record.climb_count_top * ALTITUDE_FOR_MER));
+}
+
+static void format_pressure(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%7lu Pa", altitude_record.pressure);
+}
+
+static void format_reference_pressure(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%7lu Pa", altitude_record.reference_pressure);
+}
+
+static void format_altitude(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%7.1f m", altitude_record.altitude);
+}
 
-    // Draw separation lines
-    iot_epaper_draw_horizontal_line(display_device, 0,  20, 296, COLORED);
-    iot_epaper_draw_horizontal_line(display_device, 0,  47, 296, COLORED);
-    iot_epaper_draw_horizontal_line(display_device, 0,  74, 296, COLORED);
-    iot_epaper_draw_horizontal_line(display_device, 0, 101, 296, COLORED);
+static void format_temperature(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%7.1f C", altitude_record.temperature);
+}
 
+static void format_altitude_failures(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6lu Err", altitude_update.failures);
+}
+
+static void format_heart_rate_failures(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6lu Err", heart_rate_update.failures);
+}
+
+static void format_thingspeak_failures(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6lu Err", thingspeak_update.failures);
+}
+
+static void format_reference_pressure_failures(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6lu Err", reference_pressure_update.failures);
+}
+
+static void format_wifi_failures(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6lu Err", wifi_connection.failures);
+}
+
+static void format_battery_charging(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%s", altitude_record.battery_charging ? "Yes" : "No");
+}
+
+static void format_altitude_descent(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6.0f m", altitude_record.altitude_descent);
+}
+
+static void format_climb_count_down(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%6d", altitude_record.climb_count_down);
+}
+
+static void format_chart_altitude(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%5.0f m", altitude_record.altitude);
+}
+
+static void format_chart_heart_rate(char* text)
+{
+    snprintf(text, DISPLAY_TEXT_SIZE, "%3d BPM", altitude_record.heart_rate);
+}
+
+static const display_screen_t display_screens[] = {
+    { 4, {
+        { 155,  25, &epaper_font_20, format_altitude_climbed },
+        { 155,  52, &epaper_font_20, format_heart_rate },
+        { 155,  79, &epaper_font_20, format_battery_voltage },
+        { 127, 106, &epaper_font_20, format_up_time },
+    } },
+    { 4, {
+        { 155,  25, &epaper_font_20, format_climb_count_top },
+        { 170,  52, &epaper_font_20, format_time_per_climb },
+        { 155,  79, &epaper_font_20, format_floors_count },
+        { 155, 106, &epaper_font_20, format_meters_count },
+    } },
+    { 4, {
+        { 155,  25, &epaper_font_20, format_pressure },
+        { 155,  52, &epaper_font_20, format_reference_pressure },
+        { 155,  79, &epaper_font_20, format_altitude },
+        { 155, 106, &epaper_font_20, format_temperature },
+    } },
+    { 4, {
+        { 155,  25, &epaper_font_20, format_altitude_failures },
+        { 155,  52, &epaper_font_20, format_heart_rate_failures },
+        { 155,  79, &epaper_font_20, format_thingspeak_failures },
+        { 155, 106, &epaper_font_20, format_reference_pressure_failures },
+    } },
+    { 4, {
+        { 155,  25, &epaper_font_20, format_wifi_failures },
+        { 253,  52, &epaper_font_20, format_battery_charging },
+        { 155,  79, &epaper_font_20, format_altitude_descent },
+        { 155, 106, &epaper_font_20, format_climb_count_down },
+    } },
+    { 2, {
+        {   7,  46, &epaper_font_16, format_chart_altitude },
+        {   7, 100, &epaper_font_16, format_chart_heart_rate },
+    } },
+};
+
+static const display_chart_t display_charts[] = {
+    { 5, 100, 24, &altitude_chart },
+    { 5, 100, 78, &heart_rate_chart },
+};
+
+#define DISPLAY_SCREEN_COUNT    ((int) (sizeof(display_screens) / sizeof(display_screens[0])))
+#define DISPLAY_CHART_COUNT     ((int) (sizeof(display_charts) / sizeof(display_charts[0])))
+
+/* Icons of failed updates drawn by show_status_line(), one bit each
+ */
+static int status_line_failures()
+{
+    return (altitude_update.result != ESP_OK) << 0
+            | (wifi_connection.result != ESP_OK) << 1
+            | (thingspeak_update.result != ESP_OK) << 2
+            | (reference_pressure_update.result != ESP_OK) << 3
+            | (heart_rate_update.result != ESP_OK) << 4;
+}
+
+// Add heart rate samples received since the last display update to the chart
+static void add_heart_rate_samples(void)
+{
+    int samples[HEART_RATE_PENDING_MAX];
+
+    portENTER_CRITICAL(&heart_rate_pending_mux);
+    int count = heart_rate_pending_count;
+    memcpy(samples, heart_rate_pending, count * sizeof(samples[0]));
+    heart_rate_pending_count = 0;
+    portEXIT_CRITICAL(&heart_rate_pending_mux);
+
+    if (count > 0 && heart_rate_chart.plot == NULL) {
+        iot_epaper_chart_init(&heart_rate_chart, heart_rate_plot, CHART_WIDTH, CHART_HEIGHT,
+                HEART_RATE_CHART_MIN, HEART_RATE_CHART_MAX);
+    }
+    for (int i = 0; i < count; i++) {
+        iot_epaper_chart_add(&heart_rate_chart, samples[i]);
+    }
+    chart_samples += count;
 }
 
 void update_display(int screen_number_to_show)
 {
-    char value_str[10];
+    char text[DISPLAY_FIELDS_MAX][DISPLAY_TEXT_SIZE] = {{0}};
+    const display_screen_t* screen = NULL;
+    int field_count = 0;
+    bool charts_shown = false;
 
+    add_heart_rate_samples();
     if (screen_number_to_show != -1){
         active_screen = screen_number_to_show;
     }
-    ESP_LOGI(TAG, "Updating display to show screen %d", active_screen);
-
-    init_display();
+    if (active_screen >= 0 && active_screen < DISPLAY_SCREEN_COUNT) {
+        screen = &display_screens[active_screen];
+        field_count = screen->field_count;
+    } else {
+        ESP_LOGW(TAG, "Screen %d is not implemented!", active_screen);
+    }
+    for (int i = 0; i < field_count; i++) {
+        screen->fields[i].format(text[i]);
+    }
+    for (int i = 0; i < DISPLAY_CHART_COUNT; i++) {
+        charts_shown |= display_charts[i].screen == active_screen;
+    }
 
-    iot_epaper_clean_paint(display_device, UNCOLORED);
-    show_status_line();
-
-    switch (active_screen) {
-        case 0:
-            iot_epaper_draw_string(display_device, 10,  25, "Climbed", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 10,  52, "Heart Rate", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 10,  79, "Battery", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 10, 106, "Up Time", &epaper_font_20, COLORED);
-
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6.0f m", altitude_record.altitude_climbed);
-            iot_epaper_draw_string(display_device, 155,  25, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6d BPM", altitude_record.heart_rate);
-            iot_epaper_draw_string(display_device, 155,  52, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6.2f V", altitude_record.battery_voltage);
-            iot_epaper_draw_string(display_device, 155,  79, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            update_to_now(&altitude_record.up_time);
-            int hours   = (int) (altitude_record.up_time / 3600);
-            int minutes = (int) ((altitude_record.up_time / 60) % 60);
-            int seconds = (int) (altitude_record.up_time % 60);
-            sprintf(value_str, "%2d:%02d:%02d", hours, minutes, seconds);
-            iot_epaper_draw_string(display_device, 127, 106, value_str, &epaper_font_20, COLORED);
-            break;
-        case 1:
-            iot_epaper_draw_string(display_device, 7,  25, "Climb Top", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  52, "Time/Climb", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  79, "Floors Cnt", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7, 106, "Meters Cnt", &epaper_font_20, COLORED);
-
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%9d", altitude_record.climb_count_top);
-            iot_epaper_draw_string(display_device, 155,  25, value_str, &epaper_font_20, COLORED);
-            if (altitude_record.climb_count_top == 0) {
-                strcpy(value_str,  "-");
-                iot_epaper_draw_string(display_device, 267,  52, value_str, &epaper_font_20, COLORED);
-                iot_epaper_draw_string(display_device, 267,  79, value_str, &epaper_font_20, COLORED);
-                iot_epaper_draw_string(display_device, 267, 106, value_str, &epaper_font_20, COLORED);
-            } else {
-                memset(value_str, 0x00, sizeof(value_str));
-                update_to_now(&altitude_record.up_time);
-                unsigned long seconds_climb = altitude_record.up_time / altitude_record.climb_count_top;
-                int hours   = (int) (seconds_climb / 3600);
-                int minutes = (int) ((seconds_climb / 60) % 60);
-                int seconds = (int) (seconds_climb % 60);
-                sprintf(value_str, "%2d:%02d:%02d", hours, minutes, seconds);
-                iot_epaper_draw_string(display_device, 170,  52, value_str, &epaper_font_20, COLORED);
-                memset(value_str, 0x00, sizeof(value_str));
-                sprintf(value_str, "%9d", altitude_record.climb_count_top * FLOORS_FOR_MER);
-                iot_epaper_draw_string(display_device, 155,  79, value_str, &epaper_font_20, COLORED);
-                memset(value_str, 0x00, sizeof(value_str));
-                sprintf(value_str, "%9d", (int) (altitude_record.climb_count_top * ALTITUDE_FOR_MER));
-                iot_epaper_draw_string(display_device, 155, 106, value_str, &epaper_font_20, COLORED);
+    int status = status_line_failures();
+    if (active_screen == shown_screen && status == shown_status
+            && memcmp(text, shown_text, sizeof(text)) == 0
+            && (charts_shown == false || chart_samples == shown_chart_samples)) {
+        // display is not even initialized after wake up
+        ESP_LOGI(TAG, "Screen %d shows the same, display update skipped", active_screen);
+    } else {
+        ESP_LOGI(TAG, "Updating display to show screen %d", active_screen);
+        init_display();
+
+        // nothing drawn survives deep sleep, so the screen is drawn whole
+        // and the driver transfers only tiles that differ from the screen
+        iot_epaper_begin_draw(display_device);
+        // labels and lines of the screen, values are drawn over them
+        if (active_screen >= 0 && active_screen < SCREEN_BACKGROUND_COUNT - 1) {
+            iot_epaper_load_paint(display_device, screen_backgrounds[active_screen]);
+        } else {
+            iot_epaper_load_paint(display_device, screen_backgrounds[SCREEN_BACKGROUND_COUNT - 1]);
+        }
+        show_status_line();
+        for (int i = 0; i < field_count; i++) {
+            const display_field_t* field = &screen->fields[i];
+            iot_epaper_draw_string(display_device, field->x, field->y, text[i], field->font, COLORED);
+        }
+        // plots are kept up to date by each sample, here they are only copied
+        for (int i = 0; i < DISPLAY_CHART_COUNT; i++) {
+            const display_chart_t* chart = &display_charts[i];
+            if (chart->screen == active_screen && chart->chart->plot != NULL) {
+                iot_epaper_draw_chart(display_device, chart->chart, chart->x, chart->y, COLORED);
             }
-            break;
-        case 2:
-            iot_epaper_draw_string(display_device, 7,  25, "Pressure", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  52, "Rf Pressure", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  79, "Altitude", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7, 106, "Temperature", &epaper_font_20, COLORED);
-
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%7lu Pa", altitude_record.pressure);
-            iot_epaper_draw_string(display_device, 155,  25, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%7lu Pa", altitude_record.reference_pressure);
-            iot_epaper_draw_string(display_device, 155,  52, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%7.1f m", altitude_record.altitude);
-            iot_epaper_draw_string(display_device, 155,  79, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%7.1f C", altitude_record.temperature);
-            iot_epaper_draw_string(display_device, 155, 106, value_str, &epaper_font_20, COLORED);
-            break;
-        case 3:
-            iot_epaper_draw_string(display_device, 7,  25, "BMP180", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  52, "Polar H7", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  79, "ThingSpeak", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7, 106, "OpenWeather", &epaper_font_20, COLORED);
-
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6lu Err", altitude_update.failures);
-            iot_epaper_draw_string(display_device, 155,  25, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6lu Err", heart_rate_update.failures);
-            iot_epaper_draw_string(display_device, 155,  52, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6lu Err", thingspeak_update.failures);
-            iot_epaper_draw_string(display_device, 155,  79, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6lu Err", reference_pressure_update.failures);
-            iot_epaper_draw_string(display_device, 155, 106, value_str, &epaper_font_20, COLORED);
-            break;
-        case 4:
-            iot_epaper_draw_string(display_device, 7,  25, "Wi-Fi Conn", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  52, "Batt Charging", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7,  79, "Descent", &epaper_font_20, COLORED);
-            iot_epaper_draw_string(display_device, 7, 106, "Climb Down", &epaper_font_20, COLORED);
-
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6lu Err", wifi_connection.failures);
-            iot_epaper_draw_string(display_device, 155,  25, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%s", altitude_record.battery_charging ? "Yes" : "No");
-            iot_epaper_draw_string(display_device, 253,  52, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6.0f m", altitude_record.altitude_descent);
-            iot_epaper_draw_string(display_device, 155,  79, value_str, &epaper_font_20, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%6d", altitude_record.climb_count_down);
-            iot_epaper_draw_string(display_device, 155, 106, value_str, &epaper_font_20, COLORED);
-            break;
-        case 5:
-            iot_epaper_draw_string(display_device, 80,  52, "Screen", &epaper_font_24, COLORED);
-            memset(value_str, 0x00, sizeof(value_str));
-            sprintf(value_str, "%d", active_screen);
-            iot_epaper_draw_string(display_device, 190,  52, value_str, &epaper_font_24, COLORED);
-            break;
-        default:
-            iot_epaper_draw_string(display_device, 100,  40, "Screen", &epaper_font_24, COLORED);
-            iot_epaper_draw_string(display_device, 20,  64, "Not Implemented", &epaper_font_24, COLORED);
-            ESP_LOGW(TAG, "Screen %d is not implemented!", active_screen);
+        }
+        iot_epaper_end_draw(display_device);
+        // with CONFIG_EPAPER_TEMPERATURE_WAVEFORMS, full refreshes are as short as the temperature measured last allows
+        if (altitude_update.time != 0) {
+            iot_epaper_set_temperature(display_device, (int) altitude_record.temperature);
+        }
+        // refresh continues in background, see finish_display_update()
+        iot_epaper_display_frame_async(display_device, NULL);
+
+        shown_screen = active_screen;
+        shown_status = status;
+        memcpy(shown_text, text, sizeof(text));
+        shown_chart_samples = chart_samples;
     }
-    iot_epaper_display_frame(display_device, NULL);
-    iot_epaper_sleep(display_device);
 
     active_screen++;
-    if (active_screen > 4) {
+    if (active_screen >= DISPLAY_SCREEN_COUNT) {
         active_screen = 0;
     }
 
     update_to_now(&display_update.time);
 }
 
+/* Wait until display refresh is complete and put the display into standby
+ * Light sleep may be used for waiting if Wi-Fi and BT are not on.
+ */
+void finish_display_update(bool light_sleep)
+{
+    if (display_device == NULL) {
+        return;
+    }
+    if (light_sleep) {
+        iot_epaper_light_sleep_until_idle(display_device);
+    }
+    iot_epaper_sleep(display_device);
+}
+
 void show_welcome_screen(){
 
     ESP_LOGI(TAG, "Showing welcome screen");
     init_display();
-    iot_epaper_display_frame(display_device, IMAGE_DATA);
-    iot_epaper_display_frame(display_device, IMAGE_DATA);
+    iot_epaper_set_refresh_mode(display_device, E_PAPER_REFRESH_FULL);
+    iot_epaper_display_image(display_device, &image_welcome);
+    // refresh once again to clean up the screen, the image is already in controller RAM
+    iot_epaper_display_image(display_device, &image_welcome);
+    iot_epaper_set_refresh_mode(display_device, E_PAPER_REFRESH_PARTIAL);
+    shown_screen = -1;
 }
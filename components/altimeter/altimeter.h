@@ -80,7 +80,10 @@ void publish_measurements(void);
 void update_heart_rate(void);
 void measure_altitude(void);
 void initialize_altitude_measurement(void);
+// Period [s] to measure altitude adapted to vertical speed, 0 if not adapted
+int altitude_sampling_period(void);
 void update_display(int screen_number_to_show);
+void finish_display_update(bool light_sleep);
 void show_welcome_screen();
 
 #ifdef __cplusplus
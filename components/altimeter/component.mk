@@ -1,2 +1,23 @@
 COMPONENT_ADD_INCLUDEDIRS := .
 
+# Images shown on the display, converted from PBM files at build time
+IMAGES := $(sort $(wildcard $(COMPONENT_PATH)/images/*.pbm))
+
+# Static layers of the screens, rendered on the host with the epaper-29-dke driver
+EPAPER_PATH := $(PROJECT_PATH)/components/epaper-29-dke
+BACKGROUNDS_SRCS := $(COMPONENT_PATH)/tools/screen_backgrounds.c \
+	$(EPAPER_PATH)/epaper-29-dke.c $(EPAPER_PATH)/epaper_font.c $(EPAPER_PATH)/host/epaper_sim.c
+
+CPPFLAGS += -I$(COMPONENT_BUILD_DIR)
+COMPONENT_EXTRA_CLEAN := images.h backgrounds.h screen_backgrounds
+
+altimeter.o: images.h backgrounds.h
+
+images.h: $(IMAGES) $(PROJECT_PATH)/components/epaper-29-dke/tools/epaper_image.py
+	$(PYTHON) $(PROJECT_PATH)/components/epaper-29-dke/tools/epaper_image.py --rotate 270 -o $@ $(IMAGES)
+
+screen_backgrounds: $(BACKGROUNDS_SRCS) $(wildcard $(EPAPER_PATH)/*.h $(EPAPER_PATH)/host/*.h)
+	$(HOSTCC) -O2 -I$(EPAPER_PATH)/host/include -I$(EPAPER_PATH)/host -I$(EPAPER_PATH) -o $@ $(BACKGROUNDS_SRCS) -lm
+
+backgrounds.h: screen_backgrounds
+	./screen_backgrounds $@
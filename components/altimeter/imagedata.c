@@ -1,313 +0,0 @@
-// Copyright 2015-2017 Espressif Systems (Shanghai) PTE LTD
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-
-//     http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-
-#include "imagedata.h"
-
-const unsigned char IMAGE_DATA[4736] = { /* 0X01,0X01,0X27,0X01,0X80,0X00, */
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X7F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X4F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X00,0X01,0XFF,0XF8,0X0F,0XFF,0XFF,0XFF,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XF8,0X00,0X07,0XFF,0X80,0X03,0XFF,0XFF,0XFF,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XE0,0X00,0X1F,0XFC,0X00,0X01,0XFE,0X3F,0XFF,0XFE,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XE0,0X00,0X00,0X7C,0X1F,0XFF,0XFF,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0X80,0X00,0XFF,0X80,0X00,0X00,0X3E,0X1F,0XFF,0XFF,0XEF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0X00,0X03,0XFE,0X00,0X00,0X00,0X3F,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFE,0X00,0X07,0XF8,0X00,0X00,0X00,0X3F,0X87,0XFF,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFC,0X00,0X1F,0XE0,0X00,0X00,0X00,0X3F,0XC3,0XFF,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF8,0X00,0X3F,0XC0,0X00,0X00,0X00,0X3F,0XC3,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XF0,0X00,0X7F,0X00,0X00,0X00,0X00,0X3F,0XE1,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X00,0XFE,0X00,0X00,0X00,0X00,0X3F,0XF1,0XFF,0XFE,0XE0,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X01,0XFC,0X00,0X00,0X00,0X7F,0XFF,0XF0,0XFF,0XFC,0X64,0X7F,0XFF,
-        0XFF,0XFF,0XC0,0X03,0XF8,0X00,0X00,0X07,0XFF,0XFF,0XF8,0X7F,0XFC,0XE6,0X7F,0XFF,
-        0XFF,0XFF,0X80,0X07,0XE0,0X00,0X00,0X3F,0XFF,0XFF,0XFC,0X7F,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XFF,0X80,0X0F,0XC0,0X00,0X01,0XFF,0XFF,0XFF,0XFC,0X3F,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XFF,0X00,0X1F,0X80,0X00,0X07,0XFF,0XFF,0X1F,0XFE,0X3F,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XFF,0X00,0X3F,0X00,0X00,0X1F,0XFF,0X00,0X00,0X3E,0X3F,0XFE,0X0C,0XFF,0XFF,
-        0XFF,0XFE,0X00,0X7E,0X00,0X00,0X7F,0XF8,0X00,0X00,0X1E,0X1F,0XFF,0X1C,0XFF,0XFF,
-        0XFF,0XFE,0X00,0XFC,0X00,0X00,0XFF,0XC0,0X00,0X00,0X0F,0X1F,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFE,0X00,0XFC,0X00,0X03,0XFF,0X00,0X00,0X00,0X0F,0X1F,0XFE,0XF0,0XFF,0XFF,
-        0XFF,0XFC,0X01,0XF8,0X00,0X07,0XFC,0X00,0X00,0X00,0X07,0X0F,0XFC,0X60,0X7F,0XFF,
-        0XFF,0XFC,0X03,0XF0,0X00,0X0F,0XF0,0X00,0X00,0X00,0X07,0X8F,0XFC,0XE6,0X7F,0XFF,
-        0XFF,0XFC,0X07,0XE0,0X00,0X1F,0XC0,0X00,0X00,0X00,0X07,0X8F,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XF8,0X07,0XC0,0X00,0X3F,0X80,0X00,0X00,0X00,0X07,0X8F,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XF8,0X0F,0XC0,0X00,0X7F,0X00,0X00,0X00,0X00,0X07,0X87,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XF8,0X0F,0X80,0X00,0XFC,0X00,0X00,0X00,0X00,0X07,0XC7,0XFE,0X0C,0XFF,0XFF,
-        0XFF,0XF8,0X1F,0X00,0X01,0XF8,0X00,0X00,0X00,0X00,0X0F,0XC7,0XFE,0X1C,0XFF,0XFF,
-        0XFF,0XF8,0X3F,0X00,0X03,0XF0,0X00,0X00,0X0F,0XFE,0X0F,0XC7,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XF0,0X3E,0X00,0X07,0XE0,0X00,0X00,0XFF,0XFF,0XEF,0XC7,0XFF,0XFE,0XFF,0XFF,
-        0XFF,0XF0,0X7E,0X00,0X0F,0XC0,0X00,0X03,0XFF,0XFF,0XFF,0XC7,0XFC,0XEC,0X7F,0XFF,
-        0XFF,0XF0,0X7C,0X00,0X0F,0XC0,0X00,0X0F,0XFF,0XFF,0XFF,0XC7,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XF0,0X7C,0X00,0X1F,0X80,0X00,0X3F,0XFF,0XFF,0XFF,0XC7,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XF0,0XF8,0X00,0X3F,0X00,0X00,0XFF,0XE0,0X01,0XFF,0XC7,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XF0,0XF8,0X00,0X3E,0X00,0X01,0XFF,0X00,0X00,0X3F,0XC7,0XFE,0X6C,0XFF,0XFF,
-        0XFF,0XF1,0XF0,0X00,0X7E,0X00,0X03,0XFC,0X00,0X00,0X07,0XC7,0XFE,0X00,0XFF,0XFF,
-        0XFF,0XF9,0XF0,0X00,0X7C,0X00,0X07,0XF0,0X00,0X00,0X03,0XC7,0XFF,0X83,0XFF,0XFF,
-        0XFF,0XFF,0XF0,0X00,0XFC,0X00,0X0F,0XE0,0X00,0X00,0X03,0XC7,0XFF,0XEF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X00,0XF8,0X00,0X1F,0XC0,0X00,0X00,0X03,0XC7,0XFF,0XFE,0X7F,0XFF,
-        0XFF,0XFF,0XE0,0X01,0XF8,0X00,0X3F,0X80,0X00,0X00,0X03,0XC7,0XFE,0X10,0X7F,0XFF,
-        0XFF,0XFF,0XE0,0X01,0XF0,0X00,0X7F,0X00,0X00,0X00,0X03,0XC7,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XC0,0X01,0XF0,0X00,0X7E,0X00,0X00,0X00,0X03,0X8F,0XFC,0XC7,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X03,0XE0,0X00,0XFC,0X00,0X00,0X00,0X07,0X8F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X03,0XE0,0X00,0XF8,0X00,0X00,0X00,0X07,0X8F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X03,0XE0,0X01,0XF8,0X00,0X01,0XE0,0X0F,0X8F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X07,0XC0,0X01,0XF0,0X00,0X0F,0XFE,0X1F,0X0F,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0X80,0X07,0XC0,0X03,0XE0,0X00,0X3F,0XFF,0X1F,0X1F,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0X80,0X07,0XC0,0X03,0XE0,0X00,0X7F,0XFF,0XFF,0X1F,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X07,0X80,0X07,0XE0,0X00,0XFF,0XFF,0XFE,0X1F,0XFE,0X1F,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X0F,0X80,0X07,0XC0,0X01,0XFF,0XFF,0XFE,0X3F,0XFC,0X0F,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X0F,0X80,0X07,0XC0,0X03,0XFF,0XFF,0XFC,0X3F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X0F,0X80,0X07,0XC0,0X03,0XFC,0X0F,0XFC,0X7F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X0F,0X80,0X07,0X80,0X07,0XF8,0X03,0XF8,0X7F,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X0F,0X80,0X0F,0X80,0X07,0XF0,0X01,0XF8,0XFF,0XFC,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X0F,0X80,0X0F,0X80,0X07,0XF0,0X01,0XF0,0XFF,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF0,0X0F,0X80,0X0F,0X80,0X07,0XE0,0X01,0XE1,0XFF,0XFC,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF8,0X0F,0X80,0X0F,0X80,0X07,0XE0,0X00,0XE1,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X0F,0X80,0X07,0X80,0X0F,0XE0,0X00,0XC3,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0X02,0X00,0X0F,0XE0,0X00,0X87,0XFF,0XFE,0XF0,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X0F,0XE0,0X01,0X07,0XFF,0XFC,0X60,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0X00,0X00,0X0F,0XF0,0X01,0X0F,0XFF,0XFC,0XE6,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X00,0X1F,0XF8,0X00,0X1F,0XFF,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XFF,0XF7,0XFF,0XC0,0X00,0X00,0X1F,0XFC,0X00,0X3F,0XFF,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XFF,0XE3,0XFF,0XE0,0X00,0X00,0X3F,0XFF,0XF8,0X7F,0XFF,0XFC,0XCE,0X7F,0XFF,
-        0XFF,0XFF,0XE1,0XFF,0XE0,0X00,0X00,0X3F,0XFF,0XE0,0XFF,0XFF,0XFE,0X0C,0XFF,0XFF,
-        0XFF,0XFF,0XF0,0X7F,0XF0,0X00,0X00,0X7F,0XFF,0XC1,0XFF,0XFF,0XFF,0X1C,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X3F,0XF8,0X00,0X00,0XFF,0XFF,0X83,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFC,0X0F,0XFC,0X00,0X01,0XFF,0XFE,0X07,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,
-        0XFF,0XFF,0XFE,0X07,0XFF,0X00,0X07,0XFF,0XFC,0X1F,0XFF,0XFF,0XFC,0XEC,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0X81,0XFF,0XE0,0X1F,0XFF,0XF0,0X3F,0XFF,0XFF,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XC0,0X7F,0XFF,0XFF,0XFF,0XC0,0XFF,0XFF,0XFF,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XF0,0X0F,0XFF,0XFF,0XFE,0X01,0XFF,0XFF,0XFF,0XFC,0XEE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X01,0XFF,0XFF,0XF0,0X07,0XFF,0XFF,0XFF,0XFE,0X6C,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X00,0X0F,0XFE,0X00,0X3F,0XFF,0XFF,0XFF,0XFE,0X00,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0X83,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XC1,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF9,0XFF,0XFF,0XFF,0X87,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF3,0XFF,0XFF,0XFF,0X0F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0XFF,0XFF,0XFE,0X1F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XF8,0X7F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,0XFF,0XF0,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X7F,0XFF,0XFF,0XE0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X87,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X7F,0XFF,0XFF,0XFF,0XC0,0X03,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC1,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X03,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFE,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFC,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X3E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF0,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X1C,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE3,0X08,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0XC0,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XC1,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XC7,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XF8,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XE0,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XC0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFE,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF8,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF0,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFB,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X00,0X3F,0XFF,0XFF,0XFF,0XFF,0XF7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFE,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFE,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFE,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFC,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0X3F,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFC,0X03,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFC,0X03,0XFF,0XFF,0XFF,0XFF,0XFC,0X7F,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFE,0X03,0XFF,0XFF,0XFF,0XFF,0XF8,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFE,0X01,0XFF,0XFF,0XFF,0XFF,0XF0,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFE,0X01,0XFF,0XFF,0XFF,0XFF,0XE1,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0X00,0XFF,0XFF,0XFF,0XFF,0XC3,0XFF,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X00,0X7F,0XFF,0XFF,0XFF,0X83,0XFF,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0X80,0X7F,0XFF,0XFF,0XFF,0X07,0XFF,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XC0,0X3F,0XFF,0XFF,0XFE,0X0F,0XFF,0XFF,0XFF,0XFF,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X3F,0XFF,0XFF,0XFC,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XF0,0X1F,0XFF,0XFF,0XF8,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X0F,0XFF,0XFF,0XF0,0X3F,0XFF,0XFF,0XFF,0XFF,0XF7,0XC0,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X0F,0XFF,0XFF,0XE0,0X7F,0XFF,0XFF,0XFF,0XFF,0XE7,0X80,0X7F,0XFF,
-        0XFF,0XFF,0XFC,0X07,0XFF,0XFF,0XC0,0X7F,0XFF,0XFF,0XFF,0XFF,0XE3,0X80,0X7F,0XFF,
-        0XFF,0XFF,0XFE,0X07,0XFF,0XFF,0X80,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0X03,0XFF,0XFF,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X1E,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0X81,0XFF,0XFE,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0X1E,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XC1,0XFF,0XFC,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0X1E,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XE0,0XFF,0XF8,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0X1E,0X3F,0XFF,
-        0XFF,0XFF,0XFF,0XF0,0XFF,0XF0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC6,0X3E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XF8,0X7F,0XE0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X3C,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X7F,0XE0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X78,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFE,0X3F,0XC0,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0XFC,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X3F,0X80,0X7F,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X9F,0X00,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XDE,0X00,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XE7,0XFE,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFC,0X01,0XFF,0XFF,0XFF,0XFF,0XFE,0X03,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF8,0X03,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF0,0X07,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XC0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFE,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X03,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFC,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XE0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XF8,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XF0,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XFE,0XFF,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XE0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X1E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XC0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X1C,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0X80,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XE3,0X88,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0X80,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X27,0XE7,0XC0,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFB,0XC7,0XC3,0XFF,0XFF,
-        0XFF,0XFF,0XFE,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFF,0XC7,0XC7,0XFF,0XFF,
-        0XFF,0XFF,0XFC,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XFB,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XF8,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X7B,0XC7,0XCF,0XFF,0XFF,
-        0XFF,0XFF,0XF0,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X07,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XF0,0X0F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XE0,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XE0,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XE0,0X00,0X07,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X03,0XC7,0XFE,0X7F,0XFF,
-        0XFF,0XFF,0XF0,0X00,0X03,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XF8,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFC,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0X80,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XC0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X3B,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XC7,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0XDF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X03,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XE0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0X3B,0XC3,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFE,0XC7,0XC0,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF0,0X3F,0XFF,0XFF,0XFF,0XFF,0XFE,0XDF,0XE0,0X1F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X1F,0XFF,0XFF,0XFF,0XFE,0XDF,0XFC,0X07,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XF8,0X00,0X03,0XFF,0XFF,0XFF,0XFE,0X03,0XFF,0X01,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X01,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF0,0X7F,0XFF,0XFF,0XFF,0XFF,0XFF,0XC0,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF8,0X3F,0XFF,0XFF,0XFF,0XF3,0XFE,0X03,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XCF,0XF8,0X0F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFE,0X6F,0XC0,0X7F,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFE,0X6F,0XC1,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0X8F,0XC7,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XF3,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFF,0XFF,0XFF,0XFF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,0XFF,0XFE,0X03,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X1F,0XFF,0XFF,0XFE,0X7F,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X0F,0XFF,0XFF,0XFF,0X9F,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X00,0X07,0XFF,0XFF,0XEF,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X80,0X00,0XFF,0XFF,0X9F,0XC7,0X9E,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE0,0X00,0X7F,0XFF,0X7F,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X3F,0XFE,0X03,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFE,0X3F,0XFF,0XFF,0XC0,0X00,0X7F,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X1F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0X9F,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XCF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XE7,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XF1,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFC,0X00,0X1F,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
-        };
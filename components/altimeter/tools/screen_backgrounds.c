@@ -0,0 +1,144 @@
+/*
+ screen_backgrounds.c - Render static layers of the altimeter screens
+
+ This file is part of the ESP32 Everest Run project
+ https://github.com/krzychb/esp32-everest-run-badge
+
+ Host program run at build time. Draws with the epaper-29-dke driver,
+ on its simulated controller, whatever update_display() shows on each
+ screen regardless of measurements: status icons in OK state, separation
+ lines and row labels. The frame buffers are written to a C header and
+ update_display() draws only values and failed icons over them.
+ Coordinates of status icons are the same as in show_status_line().
+
+ Usage: screen_backgrounds backgrounds.h
+
+ This work is licensed under the Apache License, Version 2.0, January 2004
+ See the file LICENSE for details.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "epaper-29-dke.h"
+#include "epaper_fonts.h"
+#include "epaper_sim.h"
+
+// Screens 0 to 5 of update_display() and the one of not implemented screens
+#define SCREEN_BACKGROUND_COUNT     7
+#define FRAME_BYTES                 (EPD_WIDTH / 8 * EPD_HEIGHT)
+
+typedef struct {
+    int y;
+    const char* text;
+} row_label_t;
+
+// Same frame buffer layout as display_device of altimeter.c
+static epaper_conf_t epaper_conf = {
+    .busy_active_level = 1,
+    .dc_lev_data = 1,
+    .dc_lev_cmd = 0,
+    .clk_freq_hz = 20 * 1000 * 1000,
+    .width = EPD_WIDTH,
+    .height = EPD_HEIGHT,
+    .color_inv = 1,
+};
+
+static const struct {
+    int x;
+    row_label_t rows[4];
+} screen_labels[5] = {
+    { 10, { { 25, "Climbed" },   { 52, "Heart Rate" },    { 79, "Battery" },    { 106, "Up Time" } } },
+    {  7, { { 25, "Climb Top" }, { 52, "Time/Climb" },    { 79, "Floors Cnt" }, { 106, "Meters Cnt" } } },
+    {  7, { { 25, "Pressure" },  { 52, "Rf Pressure" },   { 79, "Altitude" },   { 106, "Temperature" } } },
+    {  7, { { 25, "BMP180" },    { 52, "Polar H7" },      { 79, "ThingSpeak" }, { 106, "OpenWeather" } } },
+    {  7, { { 25, "Wi-Fi Conn" }, { 52, "Batt Charging" }, { 79, "Descent" },   { 106, "Climb Down" } } },
+};
+
+static void draw_status_line(epaper_handle_t dev)
+{
+    // Climbing, Wi-Fi, Cloud / ThingSpeak, RefP / OpenWeatherMap and HRM icons
+    iot_epaper_draw_rectangle(dev, 34, 0, 58, 17, COLORED);
+    iot_epaper_draw_string(dev,  35,  2, "/\\", &epaper_font_16, COLORED);
+    iot_epaper_draw_rectangle(dev, 82, 0, 122, 12, COLORED);
+    iot_epaper_draw_string(dev,  85,  1, "Wi-Fi", &epaper_font_12, COLORED);
+    iot_epaper_draw_rectangle(dev, 138, 0, 177, 12, COLORED);
+    iot_epaper_draw_string(dev, 140,  1, "Cloud", &epaper_font_12, COLORED);
+    iot_epaper_draw_rectangle(dev, 202, 0, 234, 12, COLORED);
+    iot_epaper_draw_string(dev, 205,  1, "RefP", &epaper_font_12, COLORED);
+    iot_epaper_draw_rectangle(dev, 262, 0, 287, 12, COLORED);
+    iot_epaper_draw_string(dev, 265,  1, "HRM", &epaper_font_12, COLORED);
+    iot_epaper_draw_horizontal_line(dev, 0,  20, 296, COLORED);
+}
+
+static void draw_row_lines(epaper_handle_t dev)
+{
+    iot_epaper_draw_horizontal_line(dev, 0,  47, 296, COLORED);
+    iot_epaper_draw_horizontal_line(dev, 0,  74, 296, COLORED);
+    iot_epaper_draw_horizontal_line(dev, 0, 101, 296, COLORED);
+}
+
+static void draw_background(epaper_handle_t dev, int screen)
+{
+    iot_epaper_clean_paint(dev, UNCOLORED);
+    draw_status_line(dev);
+    if (screen < 5) {
+        draw_row_lines(dev);
+        for (int i = 0; i < 4; i++) {
+            iot_epaper_draw_string(dev, screen_labels[screen].x, screen_labels[screen].rows[i].y,
+                    screen_labels[screen].rows[i].text, &epaper_font_20, COLORED);
+        }
+    } else if (screen == 5) {
+        // altitude and heart rate charts, their plots are right of the line
+        iot_epaper_draw_horizontal_line(dev, 0, 74, 296, COLORED);
+        iot_epaper_draw_vertical_line(dev, 94, 21, 107, COLORED);
+        iot_epaper_draw_string(dev, 7, 27, "Altitude", &epaper_font_12, COLORED);
+        iot_epaper_draw_string(dev, 7, 81, "Heart Rate", &epaper_font_12, COLORED);
+    } else {
+        draw_row_lines(dev);
+        iot_epaper_draw_string(dev, 100,  40, "Screen", &epaper_font_24, COLORED);
+        iot_epaper_draw_string(dev, 20,  64, "Not Implemented", &epaper_font_24, COLORED);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s backgrounds.h\n", argv[0]);
+        return 2;
+    }
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    epaper_handle_t dev = sim ? iot_epaper_create_with_backend(&epaper_sim_backend, sim, &epaper_conf) : NULL;
+    FILE* out = fopen(argv[1], "w");
+    if (dev == NULL || out == NULL) {
+        fprintf(stderr, "%s: cannot render to %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+
+    fprintf(out, "// Generated by screen_backgrounds, do not edit\n\n");
+    fprintf(out, "#ifndef _BACKGROUNDS_H_\n#define _BACKGROUNDS_H_\n\n");
+    fprintf(out, "#include <stdint.h>\n\n");
+    fprintf(out, "#define SCREEN_BACKGROUND_COUNT  %d\n\n", SCREEN_BACKGROUND_COUNT);
+    fprintf(out, "// Frame buffers of screens 0 to %d, the last one for screens not implemented\n",
+            SCREEN_BACKGROUND_COUNT - 2);
+    fprintf(out, "static const uint8_t screen_backgrounds[%d][%d] = {\n", SCREEN_BACKGROUND_COUNT, FRAME_BYTES);
+    for (int screen = 0; screen < SCREEN_BACKGROUND_COUNT; screen++) {
+        draw_background(dev, screen);
+        const uint8_t* image = iot_epaper_get_image(dev);
+        fprintf(out, "    {\n");
+        for (int i = 0; i < FRAME_BYTES; i += 16) {
+            fprintf(out, "       ");
+            for (int k = i; k < i + 16 && k < FRAME_BYTES; k++) {
+                fprintf(out, " 0x%02x,", image[k]);
+            }
+            fprintf(out, "\n");
+        }
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n\n#endif\n");
+
+    iot_epaper_delete(dev, true);
+    epaper_sim_delete(sim);
+    return fclose(out) == 0 ? 0 : 1;
+}
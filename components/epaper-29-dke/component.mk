@@ -1,2 +1,17 @@
 COMPONENT_ADD_INCLUDEDIRS := .
 
+ifdef CONFIG_EPAPER_FONT_SUBSET
+# Sources scanned for text drawn on the display, not those of the driver,
+# which draws only text it is given, e.g. when replaying a display list
+EPAPER_FONT_SOURCES := $(filter-out $(COMPONENT_PATH)/%, \
+	$(sort $(wildcard $(PROJECT_PATH)/main/*.c $(PROJECT_PATH)/components/*/*.c)))
+
+CPPFLAGS += -I$(COMPONENT_BUILD_DIR)
+COMPONENT_EXTRA_CLEAN := epaper_font_subset.h
+
+epaper_font.o: epaper_font_subset.h
+
+epaper_font_subset.h: $(COMPONENT_PATH)/epaper_font.c $(EPAPER_FONT_SOURCES) $(COMPONENT_PATH)/tools/epaper_font_subset.py $(SDKCONFIG_MAKEFILE)
+	$(PYTHON) $(COMPONENT_PATH)/tools/epaper_font_subset.py --chars $(CONFIG_EPAPER_FONT_EXTRA_CHARS) \
+		-o $@ $(COMPONENT_PATH)/epaper_font.c $(EPAPER_FONT_SOURCES)
+endif
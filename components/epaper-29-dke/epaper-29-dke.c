@@ -17,8 +17,6 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
-#include "driver/gpio.h"
-#include "driver/spi_master.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
@@ -27,15 +25,95 @@
 #include "freertos/queue.h"
 #include "freertos/ringbuf.h"
 #include "esp_log.h"
+#include "esp_attr.h"
 
 #include "epaper-29-dke.h"
 
 static const char* TAG = "ePaper Driver";
 
-#define EPAPER_QUE_SIZE_DEFAULT 10
+// Fonts cover printable ASCII characters from ' ' to '~'
+#define EPAPER_FONT_FIRST_CHAR      ' '
+#define EPAPER_FONT_LAST_CHAR       '~'
+#define EPAPER_FONT_CHAR_COUNT      (EPAPER_FONT_LAST_CHAR - EPAPER_FONT_FIRST_CHAR + 1)
+// Number of font / rotation combinations kept in the glyph cache
+#define EPAPER_GLYPH_CACHE_SLOTS    4
+// Glyphs a cache slot grows by, as characters are first drawn
+#define EPAPER_GLYPH_CACHE_GROW     8
+
+// Number of separate areas tracked for partial updates, more are merged
+#define EPAPER_DIRTY_RECTS_MAX      8
+// Size of buffer used to send partial update windows narrower than the frame
+#define EPAPER_WINDOW_CHUNK_SIZE    256
+// Partial updates done in a row, before a full update clears ghosting
+#define EPAPER_FULL_REFRESH_INTERVAL_DEFAULT    10
+
+// Frame diff tiles, 16 x 16 pixels of the frame buffer
+#define EPAPER_DIFF_TILE_BYTES      2
+#define EPAPER_DIFF_TILE_ROWS       16
+#define EPAPER_DIFF_TILES_X         (EPD_WIDTH / 8 / EPAPER_DIFF_TILE_BYTES)
+#define EPAPER_DIFF_TILES_Y         ((EPD_HEIGHT + EPAPER_DIFF_TILE_ROWS - 1) / EPAPER_DIFF_TILE_ROWS)
+
+// Initial size of the display list in band mode, it grows as needed
+#define EPAPER_BAND_OPS_MIN         16
+#define EPAPER_BAND_TEXT_MIN        64
+
+/* Geometry, rotation and color polarity of drawing
+ * With CONFIG_EPAPER_FIXED_GEOMETRY they are constants of the one panel
+ * the firmware drives, so coordinate mapping and clipping fold into
+ * constants in the drawing loops. Otherwise they are read from the device.
+ */
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+#define EPAPER_PAINT_WIDTH(device)  ((void) (device), EPD_WIDTH)
+#define EPAPER_PAINT_HEIGHT(device) ((void) (device), EPD_HEIGHT)
+#define EPAPER_PAINT_ROTATE(device) ((void) (device), (epaper_rotate_t) CONFIG_EPAPER_FIXED_ROTATE)
+#ifdef CONFIG_EPAPER_FIXED_COLOR_INV
+#define EPAPER_FIXED_COLOR_INV      true
+#else
+#define EPAPER_FIXED_COLOR_INV      false
+#endif
+#define EPAPER_COLOR_INV(device)    ((void) (device), EPAPER_FIXED_COLOR_INV)
+#else
+#define EPAPER_PAINT_WIDTH(device)  ((device)->paint.width)
+#define EPAPER_PAINT_HEIGHT(device) ((device)->paint.height)
+#define EPAPER_PAINT_ROTATE(device) ((device)->paint.rotate)
+#define EPAPER_COLOR_INV(device)    ((device)->pin.color_inv)
+#endif
+
+/* Controller command sequences, sent by iot_epaper_send_sequence()
+ * Each command is its opcode, number of parameters and the parameters.
+ * EPAPER_SEQ_WAIT_BUSY added to the number of parameters waits until
+ * the controller is idle after the command.
+ */
+#define EPAPER_SEQ_WAIT_BUSY        0x80
+#define EPAPER_SEQ_PARAMS_MASK      0x7F
+// Bytes of waveform LUT
+#define EPAPER_LUT_SIZE             70
+// LUT with its command and length, as in a command sequence
+#define EPAPER_LUT_SEQUENCE_SIZE    (2 + EPAPER_LUT_SIZE)
+// Panel temperature before it is set, the vendor full waveform is used
+#define EPAPER_TEMPERATURE_UNKNOWN  INT32_MIN
+
+/* Initialization after hardware reset
+ * This part of code is ePaper module specific
+ * It has been copied from the instructions as it is
+ */
+static const uint8_t epaper_init_sequence[] = {
+    E_PAPER_SW_RESET, 0 | EPAPER_SEQ_WAIT_BUSY,     // Software reset
+    0x74, 1, 0x54,                  // Set analog block control
+    0x7E, 1, 0x3B,                  // Set digital block control
+    0x11, 1, 0x03,                  // RAM data entry mode: Address counter is updated in Y direction, Y increment, X increment
+    0x3C, 1, 0x01,                  // Set border waveform for VBD (see datasheet)
+    E_PAPER_WRITE_VCOM_REGISTER, 1, 0x26,           // Set VCOM value
+    0x03, 1, 0x17,                  // Gate voltage setting (17h = 20 Volt, ranges from 10v to 21v)
+    0x04, 3, 0x41, 0x00, 0x32,      // Source voltage setting (15volt, 0 volt and -15 volt)
+};
 
-const unsigned char lut_full_update[] =
-{
+/* Waveforms of full and partial updates, in DRAM so they are sent by DMA directly
+ * The full update waveform below is the vendor one, used at any temperature
+ * unless CONFIG_EPAPER_TEMPERATURE_WAVEFORMS is set.
+ */
+static DRAM_ATTR const uint8_t epaper_lut_full_sequence[EPAPER_LUT_SEQUENCE_SIZE] = {
+    E_PAPER_WRITE_LUT_REGISTER, EPAPER_LUT_SIZE,
     0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
     0x00, 0x00, 0x10, 0xa0, 0xa0, 0x80, 0x00,
     0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
@@ -47,11 +125,62 @@ const unsigned char lut_full_update[] =
     0x04, 0x05, 0x00, 0x00, 0x00,
     0x01, 0x0e, 0x00, 0x00, 0x00,
     0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00
+    0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-const unsigned char lut_partial_update[] =
-{
+#ifdef CONFIG_EPAPER_TEMPERATURE_WAVEFORMS
+/* Experimental, not vendor tables: the phases of the waveform above scaled down.
+ * The same voltages for panels from 5 C, with phases about three quarters as long */
+static DRAM_ATTR const uint8_t epaper_lut_full_cool_sequence[EPAPER_LUT_SEQUENCE_SIZE] = {
+    E_PAPER_WRITE_LUT_REGISTER, EPAPER_LUT_SIZE,
+    0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xa0, 0xa0, 0x80, 0x00,
+    0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xa0, 0xa0, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x03, 0x00, 0x00, 0x00,
+    0x08, 0x03, 0x00, 0x00, 0x00,
+    0x05, 0x04, 0x00, 0x00, 0x00,
+    0x03, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x0a, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/* And for panels from 15 C, e.g. indoors, with phases about half as long */
+static DRAM_ATTR const uint8_t epaper_lut_full_room_sequence[EPAPER_LUT_SEQUENCE_SIZE] = {
+    E_PAPER_WRITE_LUT_REGISTER, EPAPER_LUT_SIZE,
+    0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xa0, 0xa0, 0x80, 0x00,
+    0x90, 0x50, 0xa0, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xa0, 0xa0, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x02, 0x00, 0x00, 0x00,
+    0x06, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x00, 0x00, 0x00,
+    0x01, 0x08, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+/* Full update waveforms, the first one the panel is warm enough for is used.
+ * Particles move faster in a warm panel, so shorter phases drive them as far.
+ */
+static const struct {
+    int min_temperature;    /* degrees C */
+    const uint8_t* sequence;
+} epaper_lut_full_by_temperature[] = {
+#ifdef CONFIG_EPAPER_TEMPERATURE_WAVEFORMS
+    { 15, epaper_lut_full_room_sequence },
+    { 5, epaper_lut_full_cool_sequence },
+#endif
+    { EPAPER_TEMPERATURE_UNKNOWN, epaper_lut_full_sequence },
+};
+
+static DRAM_ATTR const uint8_t epaper_lut_partial_sequence[EPAPER_LUT_SEQUENCE_SIZE] = {
+    E_PAPER_WRITE_LUT_REGISTER, EPAPER_LUT_SIZE,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x20, 0xa0, 0x80, 0x00, 0x00, 0x00, 0x00,
     0x50, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -63,81 +192,179 @@ const unsigned char lut_partial_update[] =
     0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/* Refresh of the screen with the content of controller RAM and the LUT loaded before */
+static const uint8_t epaper_refresh_sequence[] = {
+    0x3A, 1, 26,                    // write number of overscan lines: 26 dummy lines per gate
+    0x3B, 1, 0x08,                  // write time to write every line: 62us per line
+    E_PAPER_DRIVER_OUTPUT_CONTROL, 3, 0x27, 0x01, 0x00,     // configure length of update: y_len
+    0x0f, 2, 0x00, 0x00,            // configure starting-line of update: y_start
+    // bitmapped enabled phases of the update: (in this order)
+    //   80 - enable clock signal
+    //   40 - enable CP
+    //   20 - load temperature value
+    //   10 - load LUT
+    //   08 - initial display
+    //   04 - pattern display
+    //   02 - disable CP
+    //   01 - disable clock signal
+    E_PAPER_DISPLAY_UPDATE_CONTROL_2, 1, 0xC7,
+    E_PAPER_MASTER_ACTIVATION, 0,   // start update
+};
+
+static const uint8_t epaper_sleep_sequence[] = {
+    E_PAPER_DEEP_SLEEP_MODE, 0 | EPAPER_SEQ_WAIT_BUSY,
 };
 
-static portMUX_TYPE epaper_spinlock = portMUX_INITIALIZER_UNLOCKED;
-#define EPAPER_ENTER_CRITICAL(mux)    portENTER_CRITICAL(mux)
-#define EPAPER_EXIT_CRITICAL(mux)     portEXIT_CRITICAL(mux)
+/* Partial updates done since the last full update.
+ * Retained during deep sleep, as ghosting builds up across wake ups.
+ * Starts above any interval, so the first update after power on is full.
+ */
+RTC_DATA_ATTR static int epaper_partial_refresh_count = INT32_MAX;
+
+/* Hashes of tiles of the frame shown on the screen.
+ * Retained during deep sleep, so an unchanged frame is not refreshed again
+ * after wake up, and only changed tiles are transferred otherwise.
+ */
+RTC_DATA_ATTR static uint32_t epaper_frame_hash[EPAPER_DIFF_TILES_Y][EPAPER_DIFF_TILES_X];
+RTC_DATA_ATTR static bool epaper_frame_hash_valid;
 
-// LCD data/command
+/* State of the controller, as configured by the driver.
+ * Retained during deep sleep, as with epaper_conf_t.warm_start the controller
+ * stays in standby and keeps it. Cleared by hardware reset.
+ */
+typedef struct {
+    bool standby;           /* left initialized in standby by iot_epaper_sleep(), the only
+                               source of a warm start, see iot_epaper_create_with_backend() */
+    bool ram_hashed;        /* controller RAM holds the frame of epaper_frame_hash */
+    bool ram_area_valid;
+    uint8_t ram_area[6];    /* parameters of the RAM window set last, X then Y range */
+    const uint8_t* lut;     /* LUT sequence loaded last, NULL if none */
+} epaper_controller_t;
+
+RTC_DATA_ATTR static epaper_controller_t epaper_controller;
+
+/* Glyphs of one font, transposed to the frame buffer layout of one rotation.
+ * Each glyph is stored as 'rows' frame buffer rows of 'cols' pixels,
+ * so drawing it is a shifted OR (or AND NOT) of whole bytes.
+ * Only glyphs of characters drawn are kept, in the order they were first drawn.
+ */
+typedef struct {
+    const epaper_font_t* font;
+    epaper_rotate_t rotate;
+    uint8_t cols;           /* pixels per cached row */
+    uint8_t rows;           /* cached rows per glyph */
+    uint8_t row_bytes;      /* bytes per cached row */
+    uint8_t count;          /* glyphs built */
+    uint8_t capacity;       /* glyphs the bitmap has room for */
+    uint8_t max_count;      /* glyphs of the font */
+    uint8_t glyph[EPAPER_FONT_CHAR_COUNT];  /* glyph number + 1 of each character, 0 if not built */
+    uint8_t* bitmap;        /* 'capacity' glyphs of rows * row_bytes */
+} epaper_glyph_cache_t;
+
+/* State of PackBits decoding, so it may stop and resume at any byte */
+typedef struct {
+    const uint8_t* src;
+    const uint8_t* end;
+    int count;              /* bytes left in the current packet */
+    bool repeat;            /* packet is a run of 'value' */
+    uint8_t value;
+} epaper_unpack_t;
+
+/* Drawing functions recorded in the display list in band mode */
+typedef enum {
+    EPAPER_OP_CLEAN_PAINT,
+    EPAPER_OP_LOAD_PAINT,
+    EPAPER_OP_PIXEL,
+    EPAPER_OP_BLIT,
+    EPAPER_OP_CHART,
+    EPAPER_OP_CHAR,
+    EPAPER_OP_STRING,
+    EPAPER_OP_LINE,
+    EPAPER_OP_HORIZONTAL_LINE,
+    EPAPER_OP_VERTICAL_LINE,
+    EPAPER_OP_RECTANGLE,
+    EPAPER_OP_FILLED_RECTANGLE,
+    EPAPER_OP_CIRCLE,
+    EPAPER_OP_FILLED_CIRCLE,
+} epaper_op_type_t;
+
+/* Call of a drawing function, with the rotation set at the time */
+typedef struct {
+    uint8_t type;
+    uint8_t rotate;
+    uint8_t colored;
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;             /* or width, radius, character, offset of text */
+    int16_t y1;             /* or height */
+    const void* data;       /* image, bitmap, chart or font, kept by the caller */
+} epaper_op_t;
+
+/* Area of the frame buffer in absolute and inclusive coordinates */
 typedef struct {
-    uint8_t dc_io;
-    uint8_t dc_level;
-} epaper_dc_t;
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+} epaper_rect_t;
 
 typedef struct {
-    spi_device_handle_t bus;
+    const epaper_backend_t* backend;
+    void* backend_ctx;
     epaper_conf_t pin;      /* EPD properties */
     epaper_paint_t paint;   /* Paint properties */
-    epaper_dc_t dc;
     xSemaphoreHandle spi_mux;
+    epaper_refresh_mode_t refresh_mode;
+    int full_refresh_interval;
+    bool ram_valid;         /* controller RAM holds paint.image as of the last update */
+    bool refresh_pending;   /* refresh started and not waited for yet */
+    const epaper_image_t* ram_image;    /* image held by controller RAM, if any */
+    int dirty_count;        /* areas of paint.image changed since the last update */
+    epaper_rect_t dirty[EPAPER_DIRTY_RECTS_MAX];
+    bool glyph_cache_enabled;
+    int glyph_cache_next;   /* slot to be reused when all slots are taken */
+    epaper_glyph_cache_t* glyph_cache[EPAPER_GLYPH_CACHE_SLOTS];    /* allocated on first use */
+    int temperature;        /* of the panel in degrees C, selects the full update waveform */
+    uint8_t* front;         /* frame sent once the controller is idle, if double buffered */
+    bool queued;            /* front holds a frame not sent yet */
+    int queued_dirty_count; /* areas of the queued frame changed since the last update */
+    epaper_rect_t queued_dirty[EPAPER_DIRTY_RECTS_MAX];
+    int band_rows;          /* rows of paint.image in band mode, 0 if it is the whole frame */
+    int band_y0;            /* frame buffer rows held by paint.image, drawing outside is clipped */
+    int band_y1;
+    bool replaying;         /* display list is drawn, not recorded */
+    epaper_op_t* ops;       /* display list */
+    int op_count;
+    int op_size;
+    char* text;             /* strings of the display list */
+    int text_len;
+    int text_size;
 } epaper_dev_t;
 
-/* This function is called (in irq context!) just before a transmission starts.
- * It will set the D/C line to the value indicated in the user field
- */
-static void iot_epaper_pre_transfer_callback(spi_transaction_t *t)
-{
-    epaper_dc_t *dc = (epaper_dc_t *) t->user;
-    gpio_set_level((int)dc->dc_io, (int)dc->dc_level);
-}
-
-static esp_err_t _iot_epaper_spi_send(spi_device_handle_t spi, spi_transaction_t* t)
-{
-    return spi_device_transmit(spi, t);
-}
-
-void iot_epaper_send(spi_device_handle_t spi, const uint8_t *data, int len, epaper_dc_t *dc)
-{
-    esp_err_t ret;
-    if (len == 0) {
-        return;    // no need to send anything
-    }
-    spi_transaction_t t = {
-        .length = len * 8,  // Len is in bytes, transaction length is in bits.
-        .tx_buffer = data,
-        .user = (void *) dc,
-    };
-    ret = _iot_epaper_spi_send(spi, &t);
-    assert(ret == ESP_OK);
-}
-
 static void iot_epaper_send_command(epaper_handle_t dev, unsigned char command)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    device->dc.dc_io = device->pin.dc_pin;
-    device->dc.dc_level = device->pin.dc_lev_cmd;
-    iot_epaper_send(device->bus, &command, 1, &device->dc);
+    if (device->refresh_pending) {
+        // controller ignores commands until the refresh is complete
+        iot_epaper_wait_idle(dev);
+    }
+    device->backend->send(device->backend_ctx, true, &command, 1);
 }
 
 static void iot_epaper_send_byte(epaper_handle_t dev, const uint8_t data)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    device->dc.dc_io = device->pin.dc_pin;
-    device->dc.dc_level = device->pin.dc_lev_data;
-    iot_epaper_send(device->bus, &data, 1, &device->dc);
+    device->backend->send(device->backend_ctx, false, &data, 1);
 }
 
 static void iot_epaper_send_data(epaper_handle_t dev, const uint8_t *data, int length)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    device->dc.dc_io = device->pin.dc_pin;
-    device->dc.dc_level = device->pin.dc_lev_data;
-    // To Do: original driver was sending byte by byte
-    // Pay attention to possible performance issues
-    iot_epaper_send(device->bus, data, length, &device->dc);
-    ESP_LOGI(TAG, "SPI data sent %d", length);
+    device->backend->send(device->backend_ctx, false, data, length);
+    ESP_LOGD(TAG, "SPI data sent %d", length);
 }
 
 static void iot_epaper_paint_init(epaper_handle_t dev, unsigned char* image, int width, int height)
@@ -150,59 +377,22 @@ static void iot_epaper_paint_init(epaper_handle_t dev, unsigned char* image, int
     device->paint.height = height;
 }
 
-static void iot_epaper_gpio_init(epaper_conf_t * pin)
-{
-    gpio_pad_select_gpio(pin->reset_pin);
-    gpio_set_direction(pin->reset_pin, GPIO_MODE_OUTPUT);
-    gpio_set_level(pin->reset_pin, pin->rst_active_level);
-    gpio_pad_select_gpio(pin->dc_pin);
-    gpio_set_direction(pin->dc_pin, GPIO_MODE_OUTPUT);
-    gpio_set_level(pin->dc_pin, 1);
-    ets_delay_us(10000);
-    gpio_set_level(pin->dc_pin, 0);
-    gpio_pad_select_gpio(pin->busy_pin);
-    gpio_set_direction(pin->busy_pin, GPIO_MODE_INPUT);
-    gpio_set_pull_mode(pin->busy_pin, GPIO_PULLUP_ONLY);
-}
-
-static esp_err_t iot_epaper_spi_init(epaper_handle_t dev, spi_device_handle_t *e_spi, epaper_conf_t *pin)
-{
-    esp_err_t ret;
-    spi_bus_config_t buscfg = {
-        .miso_io_num = -1,  // MISO not used, we are transferring to the slave only
-        .mosi_io_num = pin->mosi_pin,
-        .sclk_io_num = pin->sck_pin,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        // The maximum size sent below covers the case
-        // when the whole frame buffer is transferred to the slave
-        .max_transfer_sz = EPD_WIDTH * EPD_HEIGHT / 8,
-    };
-    spi_device_interface_config_t devcfg = {
-        .clock_speed_hz = pin->clk_freq_hz,
-        .mode = 0,  // SPI mode 0
-        .spics_io_num = pin->cs_pin,
-        // To Do: clarify what does it mean
-        .queue_size = EPAPER_QUE_SIZE_DEFAULT,
-        // We are sending only in one direction (to the ePaper slave)
-        .flags = (SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE),
-        //Specify pre-transfer callback to handle D/C line
-        .pre_cb = iot_epaper_pre_transfer_callback,
-    };
-    ret = spi_bus_initialize(pin->spi_host, &buscfg, 2);
-    assert(ret == ESP_OK);
-    ret = spi_bus_add_device(pin->spi_host, &devcfg, e_spi);
-    assert(ret == ESP_OK);
-    return ret;
-}
-
-static void iot_epaper_set_lut(epaper_handle_t dev)
+/* Send a command sequence, each command with all its parameters in one transfer */
+static void iot_epaper_send_sequence(epaper_handle_t dev, const uint8_t* sequence, int length)
 {
-    epaper_dev_t* device = (epaper_dev_t*) dev;
-    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    iot_epaper_send_command(dev, E_PAPER_WRITE_LUT_REGISTER);
-    iot_epaper_send_data(dev, lut_full_update, sizeof(lut_full_update));
-    xSemaphoreGiveRecursive(device->spi_mux);
+    const uint8_t* end = sequence + length;
+
+    while (sequence < end) {
+        int params = sequence[1] & EPAPER_SEQ_PARAMS_MASK;
+        iot_epaper_send_command(dev, sequence[0]);
+        if (params > 0) {
+            iot_epaper_send_data(dev, sequence + 2, params);
+        }
+        if (sequence[1] & EPAPER_SEQ_WAIT_BUSY) {
+            iot_epaper_wait_idle(dev);
+        }
+        sequence += 2 + params;
+    }
 }
 
 static void iot_epaper_epd_init(epaper_handle_t dev)
@@ -211,59 +401,89 @@ static void iot_epaper_epd_init(epaper_handle_t dev)
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
 
     iot_epaper_reset(dev);                  // hardware reset
-
-    /* This part of code is ePaper module specific
-     * It has been copied from the instructions as it is
-     */
-    iot_epaper_send_command(dev, E_PAPER_SW_RESET); // Software reset
-
-    iot_epaper_send_command(dev, 0x74);     // Set analog block control
-    iot_epaper_send_byte(dev, 0x54);
-
-    iot_epaper_send_command(dev, 0x7E);     // Set digital block control
-    iot_epaper_send_byte(dev, 0x3B);
-
-    iot_epaper_send_command(dev, 0x11);     // RAM data entry mode
-    iot_epaper_send_byte(dev, 0x03);        // Address counter is updated in Y direction, Y increment, X increment
-
-    iot_epaper_send_command(dev, 0x3C);     // Set border waveform for VBD (see datasheet)
-    iot_epaper_send_byte(dev, 0x01);
-
-    iot_epaper_send_command(dev, 0x2C);     // Set VCOM value
-    iot_epaper_send_byte(dev, 0x26);
-
-    iot_epaper_send_command(dev, 0x03);     // Gate voltage setting (17h = 20 Volt, ranges from 10v to 21v)
-    iot_epaper_send_byte(dev, 0x17);
-
-    iot_epaper_send_command(dev, 0x04);     // Source voltage setting (15volt, 0 volt and -15 volt)
-    iot_epaper_send_byte(dev, 0x41);
-    iot_epaper_send_byte(dev, 0x00);
-    iot_epaper_send_byte(dev, 0x32);
-
+    iot_epaper_send_sequence(dev, epaper_init_sequence, sizeof(epaper_init_sequence));
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
-epaper_handle_t iot_epaper_create(spi_device_handle_t bus, epaper_conf_t *epconf)
+static void iot_epaper_glyph_cache_free(epaper_dev_t* device)
+{
+    for (int i = 0; i < EPAPER_GLYPH_CACHE_SLOTS; i++) {
+        if (device->glyph_cache[i] != NULL) {
+            free(device->glyph_cache[i]->bitmap);
+            free(device->glyph_cache[i]);
+        }
+    }
+    memset(device->glyph_cache, 0, sizeof(device->glyph_cache));
+    device->glyph_cache_next = 0;
+}
+
+epaper_handle_t iot_epaper_create_with_backend(const epaper_backend_t* backend, void* ctx, epaper_conf_t* epconf)
 {
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+    if (epconf->width != EPD_WIDTH || epconf->height != EPD_HEIGHT
+            || (epconf->color_inv != 0) != EPAPER_FIXED_COLOR_INV) {
+        ESP_LOGE(TAG, "panel %dx%d does not match CONFIG_EPAPER_FIXED_GEOMETRY", epconf->width, epconf->height);
+        return NULL;
+    }
+#endif
     epaper_dev_t* dev = (epaper_dev_t*) calloc(1, sizeof(epaper_dev_t));
-    dev->spi_mux = xSemaphoreCreateRecursiveMutex();
+    // bands of whole diff tiles, so each band is compared with the screen on its own
+    int band_rows = (epconf->band_rows + EPAPER_DIFF_TILE_ROWS - 1) / EPAPER_DIFF_TILE_ROWS * EPAPER_DIFF_TILE_ROWS;
+    if (band_rows <= 0 || band_rows > epconf->height) {
+        band_rows = epconf->band_rows > 0 ? epconf->height : 0;
+    }
+    int buffer_rows = band_rows ? band_rows : epconf->height;
+    // DMA capable and word aligned, so the SPI driver sends it without a bounce buffer
     uint8_t* frame_buf = (unsigned char*) heap_caps_malloc(
-            (epconf->width * epconf->height / 8), MALLOC_CAP_8BIT);
+            (epconf->width * buffer_rows / 8), MALLOC_CAP_DMA);
     if (frame_buf == NULL) {
         ESP_LOGE(TAG, "frame_buffer malloc fail");
+        free(dev);
         return NULL;
     }
-    iot_epaper_gpio_init(epconf);
-    ESP_LOGD(TAG, "gpio init ok");
-    if (bus) {
-        dev->bus = bus;
-    } else {
-        iot_epaper_spi_init(dev, &dev->bus, epconf);
-        ESP_LOGD(TAG, "spi init ok");
+    uint8_t* front = NULL;
+    if (epconf->double_buffer && band_rows == 0) {
+        front = (unsigned char*) heap_caps_malloc((epconf->width * epconf->height / 8), MALLOC_CAP_DMA);
+        if (front == NULL) {
+            ESP_LOGE(TAG, "front buffer malloc fail");
+            free(frame_buf);
+            free(dev);
+            return NULL;
+        }
+    }
+    // after deep sleep in standby, the controller is still initialized, the flag
+    // is cleared, so it is reset if the ESP32 does not get to iot_epaper_sleep() again
+    bool warm = epconf->warm_start && epaper_controller.standby;
+    epaper_controller.standby = false;
+    if (backend->init(ctx, epconf, warm) != ESP_OK) {
+        ESP_LOGE(TAG, "backend init fail");
+        free(front);
+        free(frame_buf);
+        free(dev);
+        return NULL;
     }
+    ESP_LOGD(TAG, "backend init ok");
+    dev->spi_mux = xSemaphoreCreateRecursiveMutex();
+    dev->backend = backend;
+    dev->backend_ctx = ctx;
     dev->pin = *epconf;
-    iot_epaper_epd_init(dev);
+    // the cache would take most of the memory saved by bands
+    dev->glyph_cache_enabled = epconf->band_rows == 0;
+    dev->refresh_mode = E_PAPER_REFRESH_FULL;
+    dev->full_refresh_interval = EPAPER_FULL_REFRESH_INTERVAL_DEFAULT;
+    dev->temperature = EPAPER_TEMPERATURE_UNKNOWN;
+    dev->front = front;
+    if (warm) {
+        ESP_LOGD(TAG, "warm start");
+        // a refresh may be still going on
+        iot_epaper_wait_idle(dev);
+    } else {
+        iot_epaper_epd_init(dev);
+    }
     iot_epaper_paint_init(dev, frame_buf, epconf->width, epconf->height);
+    dev->band_rows = band_rows;
+    dev->band_y0 = 0;
+    dev->band_y1 = buffer_rows - 1;
     return (epaper_handle_t) dev;
 }
 
@@ -273,11 +493,12 @@ esp_err_t iot_epaper_delete(epaper_handle_t dev, bool del_bus)
 
     iot_epaper_sleep(dev);
 
-    spi_bus_remove_device(device->bus);
-    if (del_bus) {
-        spi_bus_free(device->pin.spi_host);
-    }
+    device->backend->deinit(device->backend_ctx, del_bus);
     vSemaphoreDelete(device->spi_mux);
+    iot_epaper_glyph_cache_free(device);
+    free(device->ops);
+    free(device->text);
+    free(device->front);
     if (device->paint.image) {
         free(device->paint.image);
         device->paint.image = NULL;
@@ -289,12 +510,17 @@ esp_err_t iot_epaper_delete(epaper_handle_t dev, bool del_bus)
 int iot_epaper_get_width(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    return device->paint.width;
+    return EPAPER_PAINT_WIDTH(device);
 }
 
 void iot_epaper_set_width(epaper_handle_t dev, int width)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+    if (width != EPD_WIDTH) {
+        ESP_LOGW(TAG, "width is fixed to %d by CONFIG_EPAPER_FIXED_GEOMETRY", EPD_WIDTH);
+    }
+#endif
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
     device->paint.width = width % 8 ? width + 8 - (width % 8) : width;
     xSemaphoreGiveRecursive(device->spi_mux);
@@ -304,26 +530,39 @@ void iot_epaper_set_width(epaper_handle_t dev, int width)
 int iot_epaper_get_height(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    return device->paint.height;
+    return EPAPER_PAINT_HEIGHT(device);
 }
 
 void iot_epaper_set_height(epaper_handle_t dev, int height)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+    if (height != EPD_HEIGHT) {
+        ESP_LOGW(TAG, "height is fixed to %d by CONFIG_EPAPER_FIXED_GEOMETRY", EPD_HEIGHT);
+    }
+#endif
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
     device->paint.height = height;
+    if (device->band_rows == 0) {
+        device->band_y1 = height - 1;
+    }
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
 int iot_epaper_get_rotate(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    return device->paint.rotate;
+    return EPAPER_PAINT_ROTATE(device);
 }
 
 void iot_epaper_set_rotate(epaper_handle_t dev, int rotate)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+    if (rotate != CONFIG_EPAPER_FIXED_ROTATE) {
+        ESP_LOGW(TAG, "rotation is fixed to %d by CONFIG_EPAPER_FIXED_ROTATE", CONFIG_EPAPER_FIXED_ROTATE);
+    }
+#endif
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
     device->paint.rotate = rotate;
     xSemaphoreGiveRecursive(device->spi_mux);
@@ -335,9 +574,62 @@ void iot_epaper_set_rotate(epaper_handle_t dev, int rotate)
 unsigned char* iot_epaper_get_image(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (device->band_rows) {
+        return NULL;
+    }
     return device->paint.image;
 }
 
+/**
+ *  @brief: this records an area of the frame buffer changed since the last update.
+ *          Coordinates are absolute, inclusive and already clipped. The area is
+ *          widened to whole bytes as this is how controller RAM is addressed.
+ *          Overlapping or adjacent areas are merged, and if there are too many
+ *          areas, the new one is merged into the one that grows the least.
+ */
+static void iot_epaper_mark_absolute_dirty(epaper_dev_t* device, int x0, int y0, int x1, int y1)
+{
+    epaper_rect_t* rect;
+    int best = 0;
+    int best_growth = INT32_MAX;
+
+    x0 &= ~7;
+    x1 |= 7;
+    for (int i = 0; i < device->dirty_count; i++) {
+        rect = &device->dirty[i];
+        if (x0 <= rect->x1 + 1 && x1 + 1 >= rect->x0 && y0 <= rect->y1 + 1 && y1 + 1 >= rect->y0) {
+            best = i;
+            best_growth = 0;
+            break;
+        }
+    }
+    if (best_growth != 0 && device->dirty_count < EPAPER_DIRTY_RECTS_MAX) {
+        rect = &device->dirty[device->dirty_count++];
+        rect->x0 = x0;
+        rect->y0 = y0;
+        rect->x1 = x1;
+        rect->y1 = y1;
+        return;
+    }
+    if (best_growth != 0) {
+        for (int i = 0; i < device->dirty_count; i++) {
+            rect = &device->dirty[i];
+            int area = (rect->x1 - rect->x0 + 1) * (rect->y1 - rect->y0 + 1);
+            int merged_area = ((x1 > rect->x1 ? x1 : rect->x1) - (x0 < rect->x0 ? x0 : rect->x0) + 1)
+                    * ((y1 > rect->y1 ? y1 : rect->y1) - (y0 < rect->y0 ? y0 : rect->y0) + 1);
+            if (merged_area - area < best_growth) {
+                best_growth = merged_area - area;
+                best = i;
+            }
+        }
+    }
+    rect = &device->dirty[best];
+    rect->x0 = x0 < rect->x0 ? x0 : rect->x0;
+    rect->y0 = y0 < rect->y0 ? y0 : rect->y0;
+    rect->x1 = x1 > rect->x1 ? x1 : rect->x1;
+    rect->y1 = y1 > rect->y1 ? y1 : rect->y1;
+}
+
 /**
  *  @brief: this draws a pixel by absolute coordinates.
  *          this function won't be affected by the rotate parameter.
@@ -345,237 +637,1125 @@ unsigned char* iot_epaper_get_image(epaper_handle_t dev)
 static void iot_epaper_draw_absolute_pixel(epaper_handle_t dev, int x, int y, int colored)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    if (x < 0 || x >= device->paint.width || y < 0 || y >= device->paint.height) {
+    if (x < 0 || x >= EPAPER_PAINT_WIDTH(device) || y < device->band_y0 || y > device->band_y1) {
         return;
     }
-    EPAPER_ENTER_CRITICAL(&epaper_spinlock);
-    if (device->pin.color_inv) {
+    iot_epaper_mark_absolute_dirty(device, x, y, x, y);
+    y -= device->band_y0;
+    if (EPAPER_COLOR_INV(device)) {
         if (colored) {
-            device->paint.image[(x + y * device->paint.width) / 8] |= 0x80 >> (x % 8);
+            device->paint.image[(x + y * EPAPER_PAINT_WIDTH(device)) / 8] |= 0x80 >> (x % 8);
         } else {
-            device->paint.image[(x + y * device->paint.width) / 8] &= ~(0x80 >> (x % 8));
+            device->paint.image[(x + y * EPAPER_PAINT_WIDTH(device)) / 8] &= ~(0x80 >> (x % 8));
         }
     } else {
         if (colored) {
-            device->paint.image[(x + y * device->paint.width) / 8] &= ~(0x80 >> (x % 8));
+            device->paint.image[(x + y * EPAPER_PAINT_WIDTH(device)) / 8] &= ~(0x80 >> (x % 8));
         } else {
-            device->paint.image[(x + y * device->paint.width) / 8] |= 0x80 >> (x % 8);
+            device->paint.image[(x + y * EPAPER_PAINT_WIDTH(device)) / 8] |= 0x80 >> (x % 8);
         }
     }
-    EPAPER_EXIT_CRITICAL(&epaper_spinlock);
 }
 
-void iot_epaper_clean_paint(epaper_handle_t dev, int colored)
+/**
+ *  @brief: value of a frame buffer byte with all 8 pixels set to the given color
+ */
+static inline uint8_t iot_epaper_fill_byte(epaper_dev_t* device, int colored)
 {
-    epaper_dev_t* device = (epaper_dev_t*) dev;
-    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    for (int x = 0; x < device->paint.width; x++) {
-        for (int y = 0; y < device->paint.height; y++) {
-            iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    // with color_inv set bits are colored pixels, otherwise set bits are blank
+    return ((colored != 0) == EPAPER_COLOR_INV(device)) ? 0xFF : 0x00;
+}
+
+/**
+ *  @brief: this fills pixels x0..x1 of the frame buffer row y.
+ *          Edge bytes are masked, bytes in between are written whole.
+ *          Coordinates are absolute and have to be already clipped.
+ */
+static void iot_epaper_fill_absolute_span(epaper_dev_t* device, int x0, int x1, int y, uint8_t fill)
+{
+    uint8_t* row = device->paint.image + (y - device->band_y0) * (EPAPER_PAINT_WIDTH(device) / 8);
+    int first = x0 / 8;
+    int last = x1 / 8;
+    uint8_t first_mask = 0xFF >> (x0 % 8);
+    uint8_t last_mask = 0xFF << (7 - (x1 % 8));
+
+    if (first == last) {
+        first_mask &= last_mask;
+        row[first] = (row[first] & ~first_mask) | (fill & first_mask);
+        return;
+    }
+    row[first] = (row[first] & ~first_mask) | (fill & first_mask);
+    memset(&row[first + 1], fill, last - first - 1);
+    row[last] = (row[last] & ~last_mask) | (fill & last_mask);
+}
+
+/**
+ *  @brief: this fills a rectangle given by absolute and inclusive coordinates.
+ *          this function won't be affected by the rotate parameter.
+ */
+static void iot_epaper_fill_absolute_rect(epaper_dev_t* device, int x0, int y0, int x1, int y1, int colored)
+{
+    int row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+    uint8_t fill = iot_epaper_fill_byte(device, colored);
+
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < device->band_y0) {
+        y0 = device->band_y0;
+    }
+    if (x1 >= EPAPER_PAINT_WIDTH(device)) {
+        x1 = EPAPER_PAINT_WIDTH(device) - 1;
+    }
+    if (y1 > device->band_y1) {
+        y1 = device->band_y1;
+    }
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    iot_epaper_mark_absolute_dirty(device, x0, y0, x1, y1);
+    if (x0 == 0 && x1 == EPAPER_PAINT_WIDTH(device) - 1) {
+        // whole rows are contiguous in the frame buffer
+        memset(device->paint.image + (y0 - device->band_y0) * row_bytes, fill, (y1 - y0 + 1) * row_bytes);
+    } else {
+        for (int y = y0; y <= y1; y++) {
+            iot_epaper_fill_absolute_span(device, x0, x1, y, fill);
         }
     }
-    xSemaphoreGiveRecursive(device->spi_mux);
 }
 
 /**
- *  @brief: this displays a string on the frame buffer but not refresh
+ *  @brief: this clips a rectangle given by inclusive coordinates (x0 <= x1, y0 <= y1)
+ *          and maps it to absolute coordinates, the same way iot_epaper_draw_pixel()
+ *          maps every single pixel. Any rotation maps a rectangle to a rectangle.
+ *          Returns false if no part of the rectangle is on the screen.
  */
-void iot_epaper_draw_string(epaper_handle_t dev, int x, int y, const char* text, epaper_font_t* font, int colored)
+static bool iot_epaper_map_rect(epaper_dev_t* device, epaper_rect_t* rect)
 {
-    const char* p_text = text;
-    unsigned int counter = 0;
-    int refcolumn = x;
-    epaper_dev_t* device = (epaper_dev_t*) dev;
-    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    /* Send the string character by character on EPD */
-    while (*p_text != 0) {
-        /* Display one character on EPD */
-        iot_epaper_draw_char(dev, refcolumn, y, *p_text, font, colored);
-        /* Decrement the column position by 16 */
-        refcolumn += font->width;
-        /* Point on the next character */
-        p_text++;
-        counter++;
+    int width = EPAPER_PAINT_WIDTH(device);
+    int height = EPAPER_PAINT_HEIGHT(device);
+    epaper_rect_t r = *rect;
+
+    if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90 || EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_270) {
+        width = EPAPER_PAINT_HEIGHT(device);
+        height = EPAPER_PAINT_WIDTH(device);
     }
-    xSemaphoreGiveRecursive(device->spi_mux);
+    if (r.x0 < 0) {
+        r.x0 = 0;
+    }
+    if (r.y0 < 0) {
+        r.y0 = 0;
+    }
+    if (r.x1 >= width) {
+        r.x1 = width - 1;
+    }
+    if (r.y1 >= height) {
+        r.y1 = height - 1;
+    }
+    if (r.x0 > r.x1 || r.y0 > r.y1) {
+        return false;
+    }
+    switch (EPAPER_PAINT_ROTATE(device)) {
+        case E_PAPER_ROTATE_0:
+            *rect = r;
+            break;
+        case E_PAPER_ROTATE_90:
+            rect->x0 = EPAPER_PAINT_WIDTH(device) - r.y1;
+            rect->y0 = r.x0;
+            rect->x1 = EPAPER_PAINT_WIDTH(device) - r.y0;
+            rect->y1 = r.x1;
+            break;
+        case E_PAPER_ROTATE_180:
+            rect->x0 = EPAPER_PAINT_WIDTH(device) - r.x1;
+            rect->y0 = EPAPER_PAINT_HEIGHT(device) - r.y1;
+            rect->x1 = EPAPER_PAINT_WIDTH(device) - r.x0;
+            rect->y1 = EPAPER_PAINT_HEIGHT(device) - r.y0;
+            break;
+        case E_PAPER_ROTATE_270:
+            rect->x0 = r.y0;
+            rect->y0 = EPAPER_PAINT_HEIGHT(device) - r.x1;
+            rect->x1 = r.y1;
+            rect->y1 = EPAPER_PAINT_HEIGHT(device) - r.x0;
+            break;
+        default:
+            return false;
+    }
+    return true;
 }
 
 /**
- *  @brief: this draws a pixel by the coordinates
+ *  @brief: this fills a rectangle given by inclusive coordinates (x0 <= x1, y0 <= y1)
+ *          with spans of the frame buffer rows
  */
-void iot_epaper_draw_pixel(epaper_handle_t dev, int x, int y, int colored)
+static void iot_epaper_fill_rect(epaper_dev_t* device, int x0, int y0, int x1, int y1, int colored)
 {
-    int point_temp;
-    epaper_dev_t* device = (epaper_dev_t*) dev;
-    if (device->paint.rotate == E_PAPER_ROTATE_0) {
-        if (x < 0 || x >= device->paint.width || y < 0 || y >= device->paint.height) {
-            return;
-        }
-        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
-    } else if (device->paint.rotate == E_PAPER_ROTATE_90) {
-        if (x < 0 || x >= device->paint.height || y < 0 || y >= device->paint.width) {
-            return;
-        }
-        point_temp = x;
-        x = device->paint.width - y;
-        y = point_temp;
-        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
-    } else if (device->paint.rotate == E_PAPER_ROTATE_180) {
-        if (x < 0 || x >= device->paint.width || y < 0 || y >= device->paint.height) {
-            return;
-        }
-        x = device->paint.width - x;
-        y = device->paint.height - y;
-        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
-    } else if (device->paint.rotate == E_PAPER_ROTATE_270) {
-        if (x < 0 || x >= device->paint.height || y < 0 || y >= device->paint.width) {
-            return;
-        }
-        point_temp = x;
-        x = y;
-        y = device->paint.height - point_temp;
-        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    epaper_rect_t rect = { x0, y0, x1, y1 };
+    if (iot_epaper_map_rect(device, &rect)) {
+        iot_epaper_fill_absolute_rect(device, rect.x0, rect.y0, rect.x1, rect.y1, colored);
     }
 }
 
 /**
- *  @brief: this draws a character on the frame buffer but not refresh
+ *  @brief: in band mode this appends a call of a drawing function to the display list
+ *          and returns true. Otherwise, also while the list is replayed, it returns false
+ *          and the function should draw.
  */
-void iot_epaper_draw_char(epaper_handle_t dev, int x, int y, char ascii_char, epaper_font_t* font, int colored)
+static bool iot_epaper_record(epaper_dev_t* device, epaper_op_type_t type, int x0, int y0, int x1, int y1,
+        int colored, const void* data)
 {
-    int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->height * (font->width / 8 + (font->width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->font_table[char_offset];
-    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (device->band_rows == 0) {
+        return false;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    for (j = 0; j < font->height; j++) {
-        for (i = 0; i < font->width; i++) {
-            if (*ptr & (0x80 >> (i % 8))) {
-                iot_epaper_draw_pixel(dev, x + i, y + j, colored);
-            }
-            if (i % 8 == 7) {
-                ptr++;
-            }
-        }
-        if (font->width % 8 != 0) {
-            ptr++;
+    if (device->replaying) {
+        xSemaphoreGiveRecursive(device->spi_mux);
+        return false;
+    }
+    if (type == EPAPER_OP_CLEAN_PAINT || type == EPAPER_OP_LOAD_PAINT) {
+        // everything drawn before is covered
+        device->op_count = 0;
+        device->text_len = 0;
+    }
+    if (device->op_count == device->op_size) {
+        int size = device->op_size ? device->op_size * 2 : EPAPER_BAND_OPS_MIN;
+        epaper_op_t* ops = (epaper_op_t*) realloc(device->ops, size * sizeof(epaper_op_t));
+        if (ops == NULL) {
+            ESP_LOGE(TAG, "display list malloc fail");
+            xSemaphoreGiveRecursive(device->spi_mux);
+            return true;
         }
+        device->ops = ops;
+        device->op_size = size;
     }
+    epaper_op_t* op = &device->ops[device->op_count++];
+    op->type = type;
+    op->rotate = EPAPER_PAINT_ROTATE(device);
+    op->colored = colored;
+    op->x0 = x0;
+    op->y0 = y0;
+    op->x1 = x1;
+    op->y1 = y1;
+    op->data = data;
     xSemaphoreGiveRecursive(device->spi_mux);
+    return true;
 }
 
 /**
- *  @brief: this draws a line on the frame buffer
+ *  @brief: this records drawing of a string, like iot_epaper_record(),
+ *          with a copy of the text, as it is usually formatted into a temporary buffer
  */
-void iot_epaper_draw_line(epaper_handle_t dev, int x0, int y0, int x1, int y1,
-        int colored)
+static bool iot_epaper_record_string(epaper_dev_t* device, int x, int y, const char* text,
+        const epaper_font_t* font, int colored)
 {
-    /* Bresenham algorithm */
-    int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
-    int sx = x0 < x1 ? 1 : -1;
-    int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (device->band_rows == 0) {
+        return false;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    while ((x0 != x1) && (y0 != y1)) {
-        iot_epaper_draw_pixel(dev, x0, y0, colored);
-        if (2 * err >= dy) {
-            err += dy;
-            x0 += sx;
+    if (device->replaying) {
+        xSemaphoreGiveRecursive(device->spi_mux);
+        return false;
+    }
+    int length = strlen(text) + 1;
+    if (device->text_len + length > device->text_size) {
+        int size = device->text_size ? device->text_size * 2 : EPAPER_BAND_TEXT_MIN;
+        if (size < device->text_len + length) {
+            size = device->text_len + length;
         }
-        if (2 * err <= dx) {
-            err += dx;
-            y0 += sy;
+        char* buffer = (char*) realloc(device->text, size);
+        if (buffer == NULL) {
+            ESP_LOGE(TAG, "display list malloc fail");
+            xSemaphoreGiveRecursive(device->spi_mux);
+            return true;
         }
+        device->text = buffer;
+        device->text_size = size;
     }
+    memcpy(device->text + device->text_len, text, length);
+    iot_epaper_record(device, EPAPER_OP_STRING, x, y, device->text_len, 0, colored, font);
+    device->text_len += length;
     xSemaphoreGiveRecursive(device->spi_mux);
+    return true;
 }
 
 /**
- *  @brief: this draws a horizontal line on the frame buffer
+ *  @brief: this draws the display list into the band held by the frame buffer,
+ *          each call with the rotation it was recorded with
  */
-void iot_epaper_draw_horizontal_line(epaper_handle_t dev, int x, int y, int width, int colored)
+static void iot_epaper_replay(epaper_dev_t* device)
 {
-    int i;
-    epaper_dev_t* device = (epaper_dev_t*) dev;
-    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    for (i = x; i < x + width; i++) {
-        iot_epaper_draw_pixel(dev, i, y, colored);
+    epaper_handle_t dev = (epaper_handle_t) device;
+    epaper_rotate_t rotate = device->paint.rotate;
+
+    device->replaying = true;
+    for (int i = 0; i < device->op_count; i++) {
+        const epaper_op_t* op = &device->ops[i];
+        device->paint.rotate = op->rotate;
+        switch (op->type) {
+            case EPAPER_OP_CLEAN_PAINT:
+                iot_epaper_clean_paint(dev, op->colored);
+                break;
+            case EPAPER_OP_LOAD_PAINT:
+                iot_epaper_load_paint(dev, (const unsigned char*) op->data);
+                break;
+            case EPAPER_OP_PIXEL:
+                iot_epaper_draw_pixel(dev, op->x0, op->y0, op->colored);
+                break;
+            case EPAPER_OP_BLIT:
+                iot_epaper_blit(dev, (const uint8_t*) op->data, op->x0, op->y0, op->x1, op->y1, op->colored);
+                break;
+            case EPAPER_OP_CHART:
+                iot_epaper_draw_chart(dev, (const epaper_chart_t*) op->data, op->x0, op->y0, op->colored);
+                break;
+            case EPAPER_OP_CHAR:
+                iot_epaper_draw_char(dev, op->x0, op->y0, (char) op->x1, (epaper_font_t*) op->data, op->colored);
+                break;
+            case EPAPER_OP_STRING:
+                iot_epaper_draw_string(dev, op->x0, op->y0, device->text + op->x1,
+                        (epaper_font_t*) op->data, op->colored);
+                break;
+            case EPAPER_OP_LINE:
+                iot_epaper_draw_line(dev, op->x0, op->y0, op->x1, op->y1, op->colored);
+                break;
+            case EPAPER_OP_HORIZONTAL_LINE:
+                iot_epaper_draw_horizontal_line(dev, op->x0, op->y0, op->x1, op->colored);
+                break;
+            case EPAPER_OP_VERTICAL_LINE:
+                iot_epaper_draw_vertical_line(dev, op->x0, op->y0, op->y1, op->colored);
+                break;
+            case EPAPER_OP_RECTANGLE:
+                iot_epaper_draw_rectangle(dev, op->x0, op->y0, op->x1, op->y1, op->colored);
+                break;
+            case EPAPER_OP_FILLED_RECTANGLE:
+                iot_epaper_draw_filled_rectangle(dev, op->x0, op->y0, op->x1, op->y1, op->colored);
+                break;
+            case EPAPER_OP_CIRCLE:
+                iot_epaper_draw_circle(dev, op->x0, op->y0, op->x1, op->colored);
+                break;
+            case EPAPER_OP_FILLED_CIRCLE:
+                iot_epaper_draw_filled_circle(dev, op->x0, op->y0, op->x1, op->colored);
+                break;
+        }
     }
-    xSemaphoreGiveRecursive(device->spi_mux);
+    device->paint.rotate = rotate;
+    device->replaying = false;
 }
 
-/**
- *  @brief: this draws a vertical line on the frame buffer
- */
-void iot_epaper_draw_vertical_line(epaper_handle_t dev, int x, int y, int height, int colored)
+void iot_epaper_clean_paint(epaper_handle_t dev, int colored)
 {
-    int i;
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    for (i = y; i < y + height; i++) {
-        iot_epaper_draw_pixel(dev, x, i, colored);
+    if (iot_epaper_record(device, EPAPER_OP_CLEAN_PAINT, 0, 0, 0, 0, colored, NULL)) {
+        return;
     }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    iot_epaper_fill_absolute_rect(device, 0, 0, EPAPER_PAINT_WIDTH(device) - 1, EPAPER_PAINT_HEIGHT(device) - 1,
+            colored);
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
-/**
- *  @brief: this draws a rectangle
- */
-void iot_epaper_draw_rectangle(epaper_handle_t dev, int x0, int y0, int x1, int y1, int colored)
+void iot_epaper_load_paint(epaper_handle_t dev, const unsigned char* image)
 {
-    int min_x, min_y, max_x, max_y;
-    min_x = x1 > x0 ? x0 : x1;
-    max_x = x1 > x0 ? x1 : x0;
-    min_y = y1 > y0 ? y0 : y1;
-    max_y = y1 > y0 ? y1 : y0;
     epaper_dev_t* device = (epaper_dev_t*) dev;
+    int row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+    if (iot_epaper_record(device, EPAPER_OP_LOAD_PAINT, 0, 0, 0, 0, 0, image)) {
+        return;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    iot_epaper_draw_horizontal_line(dev, min_x, min_y, max_x - min_x + 1, colored);
-    iot_epaper_draw_horizontal_line(dev, min_x, max_y, max_x - min_x + 1, colored);
-    iot_epaper_draw_vertical_line(dev, min_x, min_y, max_y - min_y + 1, colored);
-    iot_epaper_draw_vertical_line(dev, max_x, min_y, max_y - min_y + 1, colored);
+    memcpy(device->paint.image, image + device->band_y0 * row_bytes,
+            (device->band_y1 - device->band_y0 + 1) * row_bytes);
+    iot_epaper_mark_absolute_dirty(device, 0, 0, EPAPER_PAINT_WIDTH(device) - 1, EPAPER_PAINT_HEIGHT(device) - 1);
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
 /**
- *  @brief: this draws a filled rectangle
+ *  @brief: frame buffer lock is held between these calls, so drawing functions
+ *          called in between take it again at the cost of a counter increment only
  */
-void iot_epaper_draw_filled_rectangle(epaper_handle_t dev, int x0, int y0, int x1, int y1, int colored)
+void iot_epaper_begin_draw(epaper_handle_t dev)
 {
-    int min_x, min_y, max_x, max_y;
-    int i;
-    min_x = x1 > x0 ? x0 : x1;
-    max_x = x1 > x0 ? x1 : x0;
-    min_y = y1 > y0 ? y0 : y1;
-    max_y = y1 > y0 ? y1 : y0;
     epaper_dev_t* device = (epaper_dev_t*) dev;
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    for (i = min_x; i <= max_x; i++) {
-        iot_epaper_draw_vertical_line(dev, i, min_y, max_y - min_y + 1, colored);
-    }
+}
+
+void iot_epaper_end_draw(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
 /**
- *  @brief: this draws a circle
+ *  @brief: this draws a pixel by the coordinates, without taking the lock
  */
-void iot_epaper_draw_circle(epaper_handle_t dev, int x, int y, int radius,
-        int colored)
+static void _iot_epaper_draw_pixel(epaper_dev_t* device, int x, int y, int colored)
 {
-    /* Bresenham algorithm */
+    int point_temp;
+    epaper_handle_t dev = (epaper_handle_t) device;
+    if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_0) {
+        if (x < 0 || x >= EPAPER_PAINT_WIDTH(device) || y < 0 || y >= EPAPER_PAINT_HEIGHT(device)) {
+            return;
+        }
+        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    } else if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90) {
+        if (x < 0 || x >= EPAPER_PAINT_HEIGHT(device) || y < 0 || y >= EPAPER_PAINT_WIDTH(device)) {
+            return;
+        }
+        point_temp = x;
+        x = EPAPER_PAINT_WIDTH(device) - y;
+        y = point_temp;
+        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    } else if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_180) {
+        if (x < 0 || x >= EPAPER_PAINT_WIDTH(device) || y < 0 || y >= EPAPER_PAINT_HEIGHT(device)) {
+            return;
+        }
+        x = EPAPER_PAINT_WIDTH(device) - x;
+        y = EPAPER_PAINT_HEIGHT(device) - y;
+        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    } else if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_270) {
+        if (x < 0 || x >= EPAPER_PAINT_HEIGHT(device) || y < 0 || y >= EPAPER_PAINT_WIDTH(device)) {
+            return;
+        }
+        point_temp = x;
+        x = y;
+        y = EPAPER_PAINT_HEIGHT(device) - point_temp;
+        iot_epaper_draw_absolute_pixel(dev, x, y, colored);
+    }
+}
+
+/**
+ *  @brief: this draws a pixel by the coordinates
+ */
+void iot_epaper_draw_pixel(epaper_handle_t dev, int x, int y, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_PIXEL, x, y, 0, 0, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    _iot_epaper_draw_pixel(device, x, y, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this transposes a block of 8 x 8 pixels, 'in' are rows and 'out'
+ *          columns, both with the MSB first (Hacker's Delight, transpose8)
+ */
+static void iot_epaper_transpose8(const uint8_t in[8], uint8_t out[8])
+{
+    uint32_t x = (uint32_t) in[0] << 24 | in[1] << 16 | in[2] << 8 | in[3];
+    uint32_t y = (uint32_t) in[4] << 24 | in[5] << 16 | in[6] << 8 | in[7];
+    uint32_t t;
+
+    // swap bits of 2 x 2, then pairs of 4 x 4 blocks, then 4 x 4 blocks
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = x >> 24;
+    out[1] = x >> 16;
+    out[2] = x >> 8;
+    out[3] = x;
+    out[4] = y >> 24;
+    out[5] = y >> 16;
+    out[6] = y >> 8;
+    out[7] = y;
+}
+
+static inline uint8_t iot_epaper_reverse_bits(uint8_t bits)
+{
+    bits = (bits & 0xF0) >> 4 | (bits & 0x0F) << 4;
+    bits = (bits & 0xCC) >> 2 | (bits & 0x33) << 2;
+    return (bits & 0xAA) >> 1 | (bits & 0x55) << 1;
+}
+
+/**
+ *  @brief: this draws 8 pixels of a frame buffer row, from absolute (x, y)
+ *          to the right, MSB first. Pixels outside the frame buffer are clipped.
+ */
+static void iot_epaper_blit_bits(epaper_dev_t* device, int x, int y, uint8_t bits, bool set_bits)
+{
+    int row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+
+    if (x < 0 && x > -8) {
+        bits &= 0xFF >> -x;
+    } else if (x > EPAPER_PAINT_WIDTH(device) - 8) {
+        bits &= 0xFF << (x - (EPAPER_PAINT_WIDTH(device) - 8));
+    }
+    if (bits == 0 || x <= -8 || x >= EPAPER_PAINT_WIDTH(device) || y < device->band_y0 || y > device->band_y1) {
+        return;
+    }
+    uint8_t* row = device->paint.image + (y - device->band_y0) * row_bytes;
+    int index = x >> 3;     // rounded down, also for x < 0
+    int shift = x & 7;
+    uint8_t first = bits >> shift;
+    uint8_t second = shift ? (uint8_t) (bits << (8 - shift)) : 0;
+
+    if (index >= 0 && first) {
+        row[index] = set_bits ? row[index] | first : row[index] & ~first;
+    }
+    if (index + 1 < row_bytes && second) {
+        row[index + 1] = set_bits ? row[index + 1] | second : row[index + 1] & ~second;
+    }
+}
+
+/**
+ *  @brief: this returns 8 pixels of a bitmap row from pixel i, a multiple of 8,
+ *          with pixels outside i0..i1 cleared
+ */
+static inline uint8_t iot_epaper_blit_source(const uint8_t* row, int i, int i0, int i1)
+{
+    uint8_t bits = row[i / 8];
+
+    if (i < i0) {
+        bits &= 0xFF >> (i0 - i);
+    }
+    if (i + 7 > i1) {
+        bits &= 0xFF << (i + 7 - i1);
+    }
+    return bits;
+}
+
+/**
+ *  @brief: this draws a bitmap, without taking the lock.
+ *          Pixel (i, j) of the bitmap is drawn where iot_epaper_draw_pixel()
+ *          draws (x + i, y + j). Rows are copied byte by byte for
+ *          E_PAPER_ROTATE_0 and 180, and for 90 and 270 blocks of 8 rows are
+ *          transposed, so each block column becomes 8 pixels of a frame buffer row.
+ */
+static void _iot_epaper_blit(epaper_dev_t* device, const uint8_t* bitmap, int x, int y,
+        int width, int height, int colored)
+{
+    int frame_width = EPAPER_PAINT_WIDTH(device);
+    int frame_height = EPAPER_PAINT_HEIGHT(device);
+    int screen_width = frame_width;
+    int screen_height = frame_height;
+    int src_row_bytes = (width + 7) / 8;
+    bool set_bits = iot_epaper_fill_byte(device, colored) == 0xFF;
+
+    if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90 || EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_270) {
+        screen_width = frame_height;
+        screen_height = frame_width;
+    }
+    // bitmap pixels i0..i1 of rows j0..j1 are on the screen
+    int i0 = x < 0 ? -x : 0;
+    int j0 = y < 0 ? -y : 0;
+    int i1 = (x + width > screen_width ? screen_width - x : width) - 1;
+    int j1 = (y + height > screen_height ? screen_height - y : height) - 1;
+    if (i0 > i1 || j0 > j1) {
+        return;
+    }
+
+    epaper_rect_t rect = { x + i0, y + j0, x + i1, y + j1 };
+    if (iot_epaper_map_rect(device, &rect) == false) {
+        return;
+    }
+    // the mapping may go one pixel past the frame buffer, the same way as for pixels
+    if (rect.x1 >= frame_width) {
+        rect.x1 = frame_width - 1;
+    }
+    if (rect.y1 >= frame_height) {
+        rect.y1 = frame_height - 1;
+    }
+    if (rect.x0 > rect.x1 || rect.y0 > rect.y1) {
+        return;
+    }
+    iot_epaper_mark_absolute_dirty(device, rect.x0, rect.y0, rect.x1, rect.y1);
+
+    if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_0 || EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_180) {
+        for (int j = j0; j <= j1; j++) {
+            const uint8_t* src = bitmap + j * src_row_bytes;
+            if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_180) {
+                for (int i = i0 & ~7; i <= i1; i += 8) {
+                    uint8_t bits = iot_epaper_reverse_bits(iot_epaper_blit_source(src, i, i0, i1));
+                    iot_epaper_blit_bits(device, frame_width - x - i - 7, frame_height - y - j, bits, set_bits);
+                }
+            } else if (x >= 0 && x % 8 == 0) {
+                // byte aligned, clipped already except to the band
+                if (y + j < device->band_y0 || y + j > device->band_y1) {
+                    continue;
+                }
+                uint8_t* dst = device->paint.image + (y + j - device->band_y0) * (frame_width / 8) + x / 8;
+                for (int i = i0 & ~7; i <= i1; i += 8) {
+                    uint8_t bits = iot_epaper_blit_source(src, i, i0, i1);
+                    dst[i / 8] = set_bits ? dst[i / 8] | bits : dst[i / 8] & ~bits;
+                }
+            } else {
+                for (int i = i0 & ~7; i <= i1; i += 8) {
+                    iot_epaper_blit_bits(device, x + i, y + j, iot_epaper_blit_source(src, i, i0, i1), set_bits);
+                }
+            }
+        }
+        return;
+    }
+
+    uint8_t block[8];
+    uint8_t columns[8];
+    for (int j = j0; j <= j1; j += 8) {
+        for (int i = i0 & ~7; i <= i1; i += 8) {
+            // with E_PAPER_ROTATE_90 the frame buffer x goes up the bitmap, so rows are reversed
+            for (int r = 0; r < 8; r++) {
+                uint8_t bits = j + r <= j1 ? iot_epaper_blit_source(bitmap + (j + r) * src_row_bytes, i, i0, i1) : 0;
+                block[EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90 ? 7 - r : r] = bits;
+            }
+            iot_epaper_transpose8(block, columns);
+            for (int c = 0; c < 8; c++) {
+                if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90) {
+                    iot_epaper_blit_bits(device, frame_width - y - j - 7, x + i + c, columns[c], set_bits);
+                } else {
+                    iot_epaper_blit_bits(device, y + j, frame_height - x - i - c, columns[c], set_bits);
+                }
+            }
+        }
+    }
+}
+
+void iot_epaper_blit(epaper_handle_t dev, const uint8_t* bitmap, int x, int y,
+        int width, int height, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_BLIT, x, y, width, height, colored, bitmap)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    _iot_epaper_blit(device, bitmap, x, y, width, height, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_chart_init(epaper_chart_t* chart, uint8_t* plot, int width, int height, int min, int max)
+{
+    chart->width = width;
+    chart->height = height;
+    chart->min = min;
+    chart->max = max;
+    chart->samples = 0;
+    chart->last_row = 0;
+    chart->plot = plot;
+    memset(plot, 0, EPAPER_CHART_PLOT_SIZE(width, height));
+}
+
+/**
+ *  @brief: this returns the plot row of a value, 0 is the top row
+ */
+static int iot_epaper_chart_row(const epaper_chart_t* chart, int value)
+{
+    if (value >= chart->max) {
+        return 0;
+    }
+    if (value <= chart->min) {
+        return chart->height - 1;
+    }
+    return (chart->max - value) * (chart->height - 1) / (chart->max - chart->min);
+}
+
+void iot_epaper_chart_add(epaper_chart_t* chart, int value)
+{
+    int column_bytes = EPAPER_CHART_COLUMN_BYTES(chart->height);
+    uint8_t* column = chart->plot + (chart->width - 1) * column_bytes;
+    int row = iot_epaper_chart_row(chart, value);
+    int top = row;
+    int bottom = row;
+
+    // columns are contiguous, so the whole plot scrolls by one move
+    memmove(chart->plot, chart->plot + column_bytes, (chart->width - 1) * column_bytes);
+    memset(column, 0, column_bytes);
+    if (chart->samples > 0) {
+        top = chart->last_row < row ? chart->last_row : row;
+        bottom = chart->last_row > row ? chart->last_row : row;
+    }
+    for (int r = top; r <= bottom; r++) {
+        column[r / 8] |= 0x80 >> (r % 8);
+    }
+    chart->last_row = row;
+    if (chart->samples < chart->width) {
+        chart->samples++;
+    }
+}
+
+void iot_epaper_draw_chart(epaper_handle_t dev, const epaper_chart_t* chart, int x, int y, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    int column_bytes = EPAPER_CHART_COLUMN_BYTES(chart->height);
+    bool set_bits = iot_epaper_fill_byte(device, colored) == 0xFF;
+
+    if (iot_epaper_record(device, EPAPER_OP_CHART, x, y, 0, 0, colored, chart)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    // background of the plot, this marks its rectangle dirty
+    iot_epaper_fill_rect(device, x, y, x + chart->width - 1, y + chart->height - 1,
+            colored == COLORED ? UNCOLORED : COLORED);
+    for (int c = chart->width - chart->samples; c < chart->width; c++) {
+        const uint8_t* column = chart->plot + c * column_bytes;
+        for (int k = 0; k < column_bytes; k++) {
+            if (column[k] == 0) {
+                continue;
+            }
+            // a screen column is a frame buffer row, going the other way with E_PAPER_ROTATE_90
+            switch (EPAPER_PAINT_ROTATE(device)) {
+                case E_PAPER_ROTATE_270:
+                    iot_epaper_blit_bits(device, y + 8 * k, EPAPER_PAINT_HEIGHT(device) - x - c, column[k], set_bits);
+                    break;
+                case E_PAPER_ROTATE_90:
+                    iot_epaper_blit_bits(device, EPAPER_PAINT_WIDTH(device) - y - 8 * k - 7, x + c,
+                            iot_epaper_reverse_bits(column[k]), set_bits);
+                    break;
+                default:
+                    for (int r = 0; r < 8; r++) {
+                        if (column[k] & (0x80 >> r)) {
+                            _iot_epaper_draw_pixel(device, x + c, y + 8 * k + r, colored);
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this returns bitmap of the character's glyph, NULL if the font
+ *          does not have it. Pixel (i, j) of the glyph is bit
+ *          j * row_bits + i of the bitmap, counting from MSB of the first byte.
+ */
+static const uint8_t* iot_epaper_font_glyph(const epaper_font_t* font, unsigned char ch, int* row_bits)
+{
+    int index = ch - EPAPER_FONT_FIRST_CHAR;
+    int glyph_bytes;
+
+    if (ch < EPAPER_FONT_FIRST_CHAR || ch > EPAPER_FONT_LAST_CHAR) {
+        return NULL;
+    }
+    if (font->glyph_map) {
+        if (font->glyph_map[index] == 0) {
+            return NULL;
+        }
+        index = font->glyph_map[index] - 1;
+    }
+    if (font->packed) {
+        *row_bits = font->width;
+        glyph_bytes = (font->width * font->height + 7) / 8;
+    } else {
+        *row_bits = (font->width + 7) / 8 * 8;
+        glyph_bytes = *row_bits / 8 * font->height;
+    }
+    return &font->font_table[index * glyph_bytes];
+}
+
+/**
+ *  @brief: this returns glyph cache slot for the font and current rotation,
+ *          taking over the oldest slot if needed. Returns NULL if out of memory.
+ */
+static epaper_glyph_cache_t* iot_epaper_glyph_cache_get(epaper_dev_t* device, const epaper_font_t* font)
+{
+    epaper_glyph_cache_t* cache;
+    for (int i = 0; i < EPAPER_GLYPH_CACHE_SLOTS; i++) {
+        cache = device->glyph_cache[i];
+        if (cache != NULL && cache->font == font && cache->rotate == EPAPER_PAINT_ROTATE(device)) {
+            return cache;
+        }
+    }
+    cache = device->glyph_cache[device->glyph_cache_next];
+    if (cache == NULL) {
+        cache = (epaper_glyph_cache_t*) malloc(sizeof(epaper_glyph_cache_t));
+        if (cache == NULL) {
+            ESP_LOGW(TAG, "glyph cache malloc fail");
+            return NULL;
+        }
+        device->glyph_cache[device->glyph_cache_next] = cache;
+    } else {
+        free(cache->bitmap);
+    }
+    device->glyph_cache_next = (device->glyph_cache_next + 1) % EPAPER_GLYPH_CACHE_SLOTS;
+    memset(cache, 0, sizeof(epaper_glyph_cache_t));
+
+    bool transposed = EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90
+            || EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_270;
+    cache->cols = transposed ? font->height : font->width;
+    cache->rows = transposed ? font->width : font->height;
+    cache->row_bytes = (cache->cols + 7) / 8;
+    // a font subset has as many glyphs as the highest glyph number
+    cache->max_count = font->glyph_map ? 0 : EPAPER_FONT_CHAR_COUNT;
+    for (int i = 0; font->glyph_map && i < EPAPER_FONT_CHAR_COUNT; i++) {
+        if (font->glyph_map[i] > cache->max_count) {
+            cache->max_count = font->glyph_map[i];
+        }
+    }
+    // glyphs are allocated as characters are drawn
+    cache->font = font;
+    cache->rotate = EPAPER_PAINT_ROTATE(device);
+    return cache;
+}
+
+/**
+ *  @brief: this transposes one glyph of the font into the cache,
+ *          growing the cache if it is full.
+ *          Glyph pixel (i, j) drawn at (x + i, y + j) lands on the same
+ *          absolute pixel as cached pixel (c, r) drawn at the glyph origin
+ *          returned by iot_epaper_glyph_origin().
+ *          Returns false if the font does not have the glyph or out of memory.
+ */
+static bool iot_epaper_glyph_cache_build(epaper_glyph_cache_t* cache, int index)
+{
+    const epaper_font_t* font = cache->font;
+    int row_bits;
+    const uint8_t* ptr = iot_epaper_font_glyph(font, index + EPAPER_FONT_FIRST_CHAR, &row_bits);
+    int glyph_bytes = cache->rows * cache->row_bytes;
+    int r, c;
+
+    if (ptr == NULL) {
+        return false;
+    }
+    if (cache->count == cache->capacity) {
+        int capacity = cache->capacity + EPAPER_GLYPH_CACHE_GROW;
+        if (capacity > cache->max_count) {
+            capacity = cache->max_count;
+        }
+        uint8_t* bitmap = (uint8_t*) realloc(cache->bitmap, capacity * glyph_bytes);
+        if (bitmap == NULL) {
+            ESP_LOGW(TAG, "glyph cache malloc fail");
+            return false;
+        }
+        cache->bitmap = bitmap;
+        cache->capacity = capacity;
+    }
+    uint8_t* glyph = &cache->bitmap[cache->count * glyph_bytes];
+    memset(glyph, 0, glyph_bytes);
+    cache->glyph[index] = ++cache->count;
+    for (int j = 0; j < font->height; j++) {
+        for (int i = 0; i < font->width; i++) {
+            int bit = j * row_bits + i;
+            if ((ptr[bit / 8] & (0x80 >> (bit % 8))) == 0) {
+                continue;
+            }
+            switch (cache->rotate) {
+                case E_PAPER_ROTATE_90:
+                    r = i;
+                    c = font->height - 1 - j;
+                    break;
+                case E_PAPER_ROTATE_180:
+                    r = font->height - 1 - j;
+                    c = font->width - 1 - i;
+                    break;
+                case E_PAPER_ROTATE_270:
+                    r = font->width - 1 - i;
+                    c = j;
+                    break;
+                default:
+                    r = j;
+                    c = i;
+                    break;
+            }
+            glyph[r * cache->row_bytes + c / 8] |= 0x80 >> (c % 8);
+        }
+    }
+    return true;
+}
+
+/**
+ *  @brief: this returns absolute coordinates of the top left corner
+ *          of a cached glyph drawn at (x, y)
+ */
+static void iot_epaper_glyph_origin(epaper_dev_t* device, const epaper_font_t* font,
+        int x, int y, int* abs_x, int* abs_y)
+{
+    switch (EPAPER_PAINT_ROTATE(device)) {
+        case E_PAPER_ROTATE_90:
+            *abs_x = EPAPER_PAINT_WIDTH(device) - y - (font->height - 1);
+            *abs_y = x;
+            break;
+        case E_PAPER_ROTATE_180:
+            *abs_x = EPAPER_PAINT_WIDTH(device) - x - (font->width - 1);
+            *abs_y = EPAPER_PAINT_HEIGHT(device) - y - (font->height - 1);
+            break;
+        case E_PAPER_ROTATE_270:
+            *abs_x = y;
+            *abs_y = EPAPER_PAINT_HEIGHT(device) - x - (font->width - 1);
+            break;
+        default:
+            *abs_x = x;
+            *abs_y = y;
+            break;
+    }
+}
+
+/**
+ *  @brief: this draws a character from the glyph cache.
+ *          Only characters that fit entirely on the screen are drawn,
+ *          for the others ESP_FAIL is returned and pixel by pixel
+ *          drawing with clipping should be used instead.
+ */
+static esp_err_t iot_epaper_draw_cached_char(epaper_dev_t* device, int x, int y,
+        char ascii_char, const epaper_font_t* font, int colored)
+{
+    int width = EPAPER_PAINT_WIDTH(device);
+    int height = EPAPER_PAINT_HEIGHT(device);
+    int abs_x, abs_y;
+    unsigned char ch = (unsigned char) ascii_char;
+
+    if (device->glyph_cache_enabled == false || EPAPER_PAINT_ROTATE(device) > E_PAPER_ROTATE_270
+            || ch < EPAPER_FONT_FIRST_CHAR || ch > EPAPER_FONT_LAST_CHAR) {
+        return ESP_FAIL;
+    }
+    if (EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_90 || EPAPER_PAINT_ROTATE(device) == E_PAPER_ROTATE_270) {
+        width = EPAPER_PAINT_HEIGHT(device);
+        height = EPAPER_PAINT_WIDTH(device);
+    }
+    if (x < 0 || x + font->width > width || y < 0 || y + font->height > height) {
+        return ESP_FAIL;
+    }
+    epaper_glyph_cache_t* cache = iot_epaper_glyph_cache_get(device, font);
+    if (cache == NULL) {
+        return ESP_FAIL;
+    }
+    iot_epaper_glyph_origin(device, font, x, y, &abs_x, &abs_y);
+    if (abs_x < 0 || abs_x + cache->cols > EPAPER_PAINT_WIDTH(device)
+            || abs_y < 0 || abs_y + cache->rows > EPAPER_PAINT_HEIGHT(device)) {
+        return ESP_FAIL;
+    }
+    // cached rows r0..r1 are in the band held by the frame buffer
+    int r0 = abs_y < device->band_y0 ? device->band_y0 - abs_y : 0;
+    int r1 = abs_y + cache->rows - 1 > device->band_y1 ? device->band_y1 - abs_y : cache->rows - 1;
+    if (r0 > r1) {
+        return ESP_OK;
+    }
+    int index = ch - EPAPER_FONT_FIRST_CHAR;
+    if (cache->glyph[index] == 0 && iot_epaper_glyph_cache_build(cache, index) == false) {
+        return ESP_FAIL;
+    }
+
+    const uint8_t* src = &cache->bitmap[((cache->glyph[index] - 1) * cache->rows + r0) * cache->row_bytes];
+    int frame_row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+    uint8_t* dst = device->paint.image + (abs_y + r0 - device->band_y0) * frame_row_bytes + abs_x / 8;
+    int shift = abs_x % 8;
+    // frame buffer bytes covered by one cached row
+    int dst_bytes = (shift + cache->cols + 7) / 8;
+    bool set_bits = iot_epaper_fill_byte(device, colored) == 0xFF;
+
+    iot_epaper_mark_absolute_dirty(device, abs_x, abs_y, abs_x + cache->cols - 1, abs_y + cache->rows - 1);
+    for (int r = r0; r <= r1; r++) {
+        for (int k = 0; k < dst_bytes; k++) {
+            uint8_t bits = (k < cache->row_bytes) ? src[k] >> shift : 0;
+            if (k > 0) {
+                bits |= (uint8_t) (src[k - 1] << (8 - shift));
+            }
+            if (set_bits) {
+                dst[k] |= bits;
+            } else {
+                dst[k] &= ~bits;
+            }
+        }
+        src += cache->row_bytes;
+        dst += frame_row_bytes;
+    }
+    return ESP_OK;
+}
+
+void iot_epaper_set_glyph_cache(epaper_handle_t dev, bool enable)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    device->glyph_cache_enabled = enable;
+    if (enable == false) {
+        iot_epaper_glyph_cache_free(device);
+    }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a character on the frame buffer, without taking the lock
+ */
+static void _iot_epaper_draw_char(epaper_dev_t* device, int x, int y, char ascii_char, const epaper_font_t* font, int colored)
+{
+    int i, j, row_bits;
+    if (iot_epaper_draw_cached_char(device, x, y, ascii_char, font, colored) == ESP_OK) {
+        return;
+    }
+    const unsigned char* ptr = iot_epaper_font_glyph(font, (unsigned char) ascii_char, &row_bits);
+    if (ptr == NULL) {
+        return;
+    }
+    if (font->packed == false) {
+        // rows of the glyph are whole bytes, e.g. a character partly off the screen
+        _iot_epaper_blit(device, ptr, x, y, font->width, font->height, colored);
+        return;
+    }
+    for (j = 0; j < font->height; j++) {
+        for (i = 0; i < font->width; i++) {
+            int bit = j * row_bits + i;
+            if (ptr[bit / 8] & (0x80 >> (bit % 8))) {
+                _iot_epaper_draw_pixel(device, x + i, y + j, colored);
+            }
+        }
+    }
+}
+
+/**
+ *  @brief: this draws a character on the frame buffer but not refresh
+ */
+void iot_epaper_draw_char(epaper_handle_t dev, int x, int y, char ascii_char, epaper_font_t* font, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_CHAR, x, y, (unsigned char) ascii_char, 0, colored, font)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    _iot_epaper_draw_char(device, x, y, ascii_char, font, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this displays a string on the frame buffer but not refresh
+ */
+void iot_epaper_draw_string(epaper_handle_t dev, int x, int y, const char* text, epaper_font_t* font, int colored)
+{
+    const char* p_text = text;
+    unsigned int counter = 0;
+    int refcolumn = x;
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record_string(device, x, y, text, font, colored)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    /* Send the string character by character on EPD */
+    while (*p_text != 0) {
+        /* Display one character on EPD */
+        _iot_epaper_draw_char(device, refcolumn, y, *p_text, font, colored);
+        /* Decrement the column position by 16 */
+        refcolumn += font->width;
+        /* Point on the next character */
+        p_text++;
+        counter++;
+    }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a line on the frame buffer
+ */
+void iot_epaper_draw_line(epaper_handle_t dev, int x0, int y0, int x1, int y1,
+        int colored)
+{
+    /* Bresenham algorithm */
+    int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
+    int sx = x0 < x1 ? 1 : -1;
+    int dy = y1 - y0 <= 0 ? y1 - y0 : y0 - y1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_LINE, x0, y0, x1, y1, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    while ((x0 != x1) && (y0 != y1)) {
+        _iot_epaper_draw_pixel(device, x0, y0, colored);
+        if (2 * err >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (2 * err <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a horizontal line on the frame buffer
+ */
+void iot_epaper_draw_horizontal_line(epaper_handle_t dev, int x, int y, int width, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_HORIZONTAL_LINE, x, y, width, 0, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    iot_epaper_fill_rect(device, x, y, x + width - 1, y, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a vertical line on the frame buffer
+ */
+void iot_epaper_draw_vertical_line(epaper_handle_t dev, int x, int y, int height, int colored)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_VERTICAL_LINE, x, y, 0, height, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    iot_epaper_fill_rect(device, x, y, x, y + height - 1, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a rectangle
+ */
+void iot_epaper_draw_rectangle(epaper_handle_t dev, int x0, int y0, int x1, int y1, int colored)
+{
+    int min_x, min_y, max_x, max_y;
+    min_x = x1 > x0 ? x0 : x1;
+    max_x = x1 > x0 ? x1 : x0;
+    min_y = y1 > y0 ? y0 : y1;
+    max_y = y1 > y0 ? y1 : y0;
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_RECTANGLE, x0, y0, x1, y1, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    iot_epaper_fill_rect(device, min_x, min_y, max_x, min_y, colored);
+    iot_epaper_fill_rect(device, min_x, max_y, max_x, max_y, colored);
+    iot_epaper_fill_rect(device, min_x, min_y, min_x, max_y, colored);
+    iot_epaper_fill_rect(device, max_x, min_y, max_x, max_y, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a filled rectangle
+ */
+void iot_epaper_draw_filled_rectangle(epaper_handle_t dev, int x0, int y0, int x1, int y1, int colored)
+{
+    int min_x, min_y, max_x, max_y;
+    min_x = x1 > x0 ? x0 : x1;
+    max_x = x1 > x0 ? x1 : x0;
+    min_y = y1 > y0 ? y0 : y1;
+    max_y = y1 > y0 ? y1 : y0;
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_FILLED_RECTANGLE, x0, y0, x1, y1, colored, NULL)) {
+        return;
+    }
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    iot_epaper_fill_rect(device, min_x, min_y, max_x, max_y, colored);
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+/**
+ *  @brief: this draws a circle
+ */
+void iot_epaper_draw_circle(epaper_handle_t dev, int x, int y, int radius,
+        int colored)
+{
+    /* Bresenham algorithm */
     int x_pos = -radius;
     int y_pos = 0;
     int err = 2 - 2 * radius;
     int e2;
     epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_CIRCLE, x, y, radius, 0, colored, NULL)) {
+        return;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
     do {
-        iot_epaper_draw_pixel(dev, x - x_pos, y + y_pos, colored);
-        iot_epaper_draw_pixel(dev, x + x_pos, y + y_pos, colored);
-        iot_epaper_draw_pixel(dev, x + x_pos, y - y_pos, colored);
-        iot_epaper_draw_pixel(dev, x - x_pos, y - y_pos, colored);
+        _iot_epaper_draw_pixel(device, x - x_pos, y + y_pos, colored);
+        _iot_epaper_draw_pixel(device, x + x_pos, y + y_pos, colored);
+        _iot_epaper_draw_pixel(device, x + x_pos, y - y_pos, colored);
+        _iot_epaper_draw_pixel(device, x - x_pos, y - y_pos, colored);
         e2 = err;
         if (e2 <= y_pos) {
             err += ++y_pos * 2 + 1;
@@ -601,14 +1781,17 @@ void iot_epaper_draw_filled_circle(epaper_handle_t dev, int x, int y, int radius
     int err = 2 - 2 * radius;
     int e2;
     epaper_dev_t* device = (epaper_dev_t*) dev;
+    if (iot_epaper_record(device, EPAPER_OP_FILLED_CIRCLE, x, y, radius, 0, colored, NULL)) {
+        return;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
     do {
-        iot_epaper_draw_pixel(dev, x - x_pos, y + y_pos, colored);
-        iot_epaper_draw_pixel(dev, x + x_pos, y + y_pos, colored);
-        iot_epaper_draw_pixel(dev, x + x_pos, y - y_pos, colored);
-        iot_epaper_draw_pixel(dev, x - x_pos, y - y_pos, colored);
-        iot_epaper_draw_horizontal_line(dev, x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
-        iot_epaper_draw_horizontal_line(dev, x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
+        _iot_epaper_draw_pixel(device, x - x_pos, y + y_pos, colored);
+        _iot_epaper_draw_pixel(device, x + x_pos, y + y_pos, colored);
+        _iot_epaper_draw_pixel(device, x + x_pos, y - y_pos, colored);
+        _iot_epaper_draw_pixel(device, x - x_pos, y - y_pos, colored);
+        iot_epaper_fill_rect(device, x + x_pos, y + y_pos, x - x_pos, y + y_pos, colored);
+        iot_epaper_fill_rect(device, x + x_pos, y - y_pos, x - x_pos, y - y_pos, colored);
         e2 = err;
         if (e2 <= y_pos) {
             err += ++y_pos * 2 + 1;
@@ -623,116 +1806,624 @@ void iot_epaper_draw_filled_circle(epaper_handle_t dev, int x, int y, int radius
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
+static void iot_epaper_send_queued(epaper_handle_t dev);
+
 void iot_epaper_wait_idle(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    while (gpio_get_level((gpio_num_t) device->pin.busy_pin) == device->pin.busy_active_level) {
-        vTaskDelay(10 / portTICK_RATE_MS);
+    device->backend->wait_idle(device->backend_ctx);
+    device->refresh_pending = false;
+    if (device->queued) {
+        // the queued frame is displayed and waited for as well
+        iot_epaper_send_queued(dev);
+        device->backend->wait_idle(device->backend_ctx);
+        device->refresh_pending = false;
+    }
+}
+
+bool iot_epaper_is_busy(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    bool busy = device->backend->is_busy(device->backend_ctx);
+    if (busy == false && device->queued) {
+        iot_epaper_send_queued(dev);
+        busy = device->backend->is_busy(device->backend_ctx);
     }
+    return busy;
+}
+
+void iot_epaper_light_sleep_until_idle(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    device->backend->sleep_until_idle(device->backend_ctx);
+    device->refresh_pending = false;
+    if (device->queued) {
+        iot_epaper_send_queued(dev);
+        device->backend->sleep_until_idle(device->backend_ctx);
+        device->refresh_pending = false;
+    }
+}
+
+void iot_epaper_set_idle_callback(epaper_handle_t dev, epaper_idle_cb_t cb, void* arg)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    device->backend->set_idle_callback(device->backend_ctx, cb, arg);
 }
 
 void iot_epaper_reset(epaper_handle_t dev)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    gpio_set_level((gpio_num_t) device->pin.reset_pin, (~(device->pin.rst_active_level)) & 0x1);
-    ets_delay_us(200);
-    gpio_set_level((gpio_num_t) device->pin.reset_pin, (device->pin.rst_active_level) & 0x1);             //module reset
-    ets_delay_us(200);
-    gpio_set_level((gpio_num_t) device->pin.reset_pin, (~(device->pin.rst_active_level)) & 0x1);
+    device->backend->reset(device->backend_ctx);
+    // a queued frame would be sent before the controller is initialized again
+    device->queued = false;
     iot_epaper_wait_idle(dev);
+    device->ram_valid = false;
+    device->ram_image = NULL;
+    memset(&epaper_controller, 0, sizeof(epaper_controller));
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
-/* This function has been exposed to implement partial updates of the image
- * To Do: implement partial updates of the image
+/* Set controller RAM window, used to update part of the image
+ * x coordinates are rounded down to a multiple of 8 pixels
+ * Nothing is sent if the controller already has this window.
  */
 void iot_set_ram_area(epaper_handle_t dev, int x_start, int y_start, int x_end, int y_end)
 {
+    // parameters of a command are sent at once, with a single D/C transition
+    const uint8_t area[] = {
+        x_start >> 3, x_end >> 3,   // 8 pixels per byte
+        y_start & 0xff, y_start >> 8, y_end & 0xff, y_end >> 8,
+    };
+    if (epaper_controller.ram_area_valid && memcmp(epaper_controller.ram_area, area, sizeof(area)) == 0) {
+        return;
+    }
     iot_epaper_send_command(dev, E_PAPER_SET_RAM_X_ADDRESS_START_END_POSITION);
-    iot_epaper_send_byte(dev, x_start >> 3);  // 8 pixels per byte
-    iot_epaper_send_byte(dev, x_end   >> 3);  // 8 pixels per byte
+    iot_epaper_send_data(dev, area, 2);
     iot_epaper_send_command(dev, E_PAPER_SET_RAM_Y_ADDRESS_START_END_POSITION);
-    iot_epaper_send_byte(dev, y_start & 0xff);
-    iot_epaper_send_byte(dev, y_start >> 8);
-    iot_epaper_send_byte(dev, y_end & 0xff);
-    iot_epaper_send_byte(dev, y_end   >> 8);
+    iot_epaper_send_data(dev, area + 2, 4);
+    memcpy(epaper_controller.ram_area, area, sizeof(area));
+    epaper_controller.ram_area_valid = true;
 }
 
-/* This function has been exposed to implement partial updates of the image
- * To Do: implement partial updates of the image
+/* Set controller RAM address where the following image data is written
  */
 void iot_set_ram_address_counter(epaper_handle_t dev, int x, int y)
 {
+    const uint8_t y_counter[] = { y & 0xff, y >> 8 };
     iot_epaper_send_command(dev, E_PAPER_SET_RAM_X_ADDRESS_COUNTER);
     iot_epaper_send_byte(dev, x >> 3);  // 8 pixels per byte
     iot_epaper_send_command(dev, E_PAPER_SET_RAM_Y_ADDRESS_COUNTER);
-    iot_epaper_send_byte(dev, y & 0xff);
-    iot_epaper_send_byte(dev, y >> 8);
+    iot_epaper_send_data(dev, y_counter, sizeof(y_counter));
 }
 
-/* This transfer to the display the whole image frame
- * To Do: implement partial updates of the image
+/* Transfer one area of the image to controller RAM
+ * 'frame_buffer' holds frame rows from 'buffer_y0' on, as a band does.
  */
-void iot_epaper_display_frame(epaper_handle_t dev, const unsigned char* frame_buffer)
+static void iot_epaper_write_ram_window(epaper_handle_t dev, const unsigned char* frame_buffer, int buffer_y0,
+        const epaper_rect_t* rect)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    int row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+    int first = rect->x0 / 8;
+    int window_bytes = rect->x1 / 8 - first + 1;
+    WORD_ALIGNED_ATTR uint8_t chunk[EPAPER_WINDOW_CHUNK_SIZE];
+    int chunk_len = 0;
+
+    iot_set_ram_area(dev, rect->x0, rect->y0, rect->x1, rect->y1);
+    iot_set_ram_address_counter(dev, rect->x0, rect->y0);
+    iot_epaper_send_command(dev, E_PAPER_WRITE_RAM);
+    if (window_bytes == row_bytes) {
+        iot_epaper_send_data(dev, frame_buffer + (rect->y0 - buffer_y0) * row_bytes,
+                (rect->y1 - rect->y0 + 1) * row_bytes);
+        return;
+    }
+    // rows of a window narrower than the frame are not contiguous, send them in chunks
+    for (int y = rect->y0; y <= rect->y1; y++) {
+        if (chunk_len + window_bytes > EPAPER_WINDOW_CHUNK_SIZE) {
+            iot_epaper_send_data(dev, chunk, chunk_len);
+            chunk_len = 0;
+        }
+        memcpy(chunk + chunk_len, frame_buffer + (y - buffer_y0) * row_bytes + first, window_bytes);
+        chunk_len += window_bytes;
+    }
+    iot_epaper_send_data(dev, chunk, chunk_len);
+}
+
+/* Decompress up to 'length' bytes of PackBits data
+ * Header byte n >= 0 is followed by n + 1 bytes to copy,
+ * n < 0 (except -128) by a byte to repeat 1 - n times.
+ * Returns number of bytes decompressed, less than 'length' at the end of data.
+ */
+static int iot_epaper_unpack(epaper_unpack_t* unpack, uint8_t* dst, int length)
+{
+    int done = 0;
+
+    while (done < length) {
+        if (unpack->count == 0) {
+            if (unpack->src >= unpack->end) {
+                break;
+            }
+            int header = (int8_t) *unpack->src++;
+            if (header >= 0) {
+                unpack->count = header + 1;
+                unpack->repeat = false;
+            } else if (header != -128) {
+                if (unpack->src >= unpack->end) {
+                    break;
+                }
+                unpack->count = 1 - header;
+                unpack->repeat = true;
+                unpack->value = *unpack->src++;
+            }
+            continue;
+        }
+        int n = unpack->count < length - done ? unpack->count : length - done;
+        if (unpack->repeat) {
+            memset(dst + done, unpack->value, n);
+        } else {
+            if (n > unpack->end - unpack->src) {
+                n = unpack->end - unpack->src;
+                if (n == 0) {
+                    break;
+                }
+            }
+            memcpy(dst + done, unpack->src, n);
+            unpack->src += n;
+        }
+        unpack->count -= n;
+        done += n;
+    }
+    return done;
+}
+
+/* Transfer compressed image to controller RAM, decompressing it in chunks
+ * Returns false if the image data is shorter than the image.
+ */
+static bool iot_epaper_write_ram_image(epaper_handle_t dev, const epaper_image_t* image)
+{
+    epaper_unpack_t unpack = {
+        .src = image->data,
+        .end = image->data + image->size,
+    };
+    WORD_ALIGNED_ATTR uint8_t chunk[EPAPER_WINDOW_CHUNK_SIZE];
+    int remaining = image->width / 8 * image->height;
+
+    iot_set_ram_area(dev, 0, 0, image->width - 1, image->height - 1);
+    iot_set_ram_address_counter(dev, 0, 0);
+    iot_epaper_send_command(dev, E_PAPER_WRITE_RAM);
+    while (remaining > 0) {
+        int length = iot_epaper_unpack(&unpack, chunk, remaining < EPAPER_WINDOW_CHUNK_SIZE ? remaining : EPAPER_WINDOW_CHUNK_SIZE);
+        if (length == 0) {
+            return false;
+        }
+        iot_epaper_send_data(dev, chunk, length);
+        remaining -= length;
+    }
+    return true;
+}
+
+/* Calculate FNV-1a hash of each tile of frame rows y0 to y1, held by 'frame_buffer'
+ * y0 is the first row of a tile, y1 the last one or the last row of the frame.
+ * Returns false if the frame is not of the size tiles are laid out for
+ */
+static bool iot_epaper_hash_frame(epaper_dev_t* device, const unsigned char* frame_buffer, int y0, int y1,
+        uint32_t hash[EPAPER_DIFF_TILES_Y][EPAPER_DIFF_TILES_X])
+{
+    int row_bytes = EPAPER_PAINT_WIDTH(device) / 8;
+
+    if (EPAPER_PAINT_WIDTH(device) != EPD_WIDTH || EPAPER_PAINT_HEIGHT(device) != EPD_HEIGHT) {
+        return false;
+    }
+    for (int ty = y0 / EPAPER_DIFF_TILE_ROWS; ty * EPAPER_DIFF_TILE_ROWS <= y1; ty++) {
+        for (int tx = 0; tx < EPAPER_DIFF_TILES_X; tx++) {
+            hash[ty][tx] = 2166136261u;
+        }
+        for (int y = ty * EPAPER_DIFF_TILE_ROWS; y < (ty + 1) * EPAPER_DIFF_TILE_ROWS && y <= y1; y++) {
+            const unsigned char* row = frame_buffer + (y - y0) * row_bytes;
+            for (int x = 0; x < row_bytes; x++) {
+                uint32_t* h = &hash[ty][x / EPAPER_DIFF_TILE_BYTES];
+                *h = (*h ^ row[x]) * 16777619u;
+            }
+        }
+    }
+    return true;
+}
+
+/* Replace areas to update with tiles of rows ty0 to ty1 that differ from the frame on the screen
+ * Changed tiles next to each other in a row are joined into one area,
+ * which is then merged with areas it touches by iot_epaper_mark_absolute_dirty().
+ * Returns number of changed tiles.
+ */
+static int iot_epaper_diff_frame(epaper_dev_t* device, uint32_t hash[EPAPER_DIFF_TILES_Y][EPAPER_DIFF_TILES_X],
+        int ty0, int ty1)
+{
+    const int tile_width = EPAPER_DIFF_TILE_BYTES * 8;
+    int changed = 0;
+
+    device->dirty_count = 0;
+    for (int ty = ty0; ty <= ty1; ty++) {
+        int y0 = ty * EPAPER_DIFF_TILE_ROWS;
+        int y1 = y0 + EPAPER_DIFF_TILE_ROWS - 1;
+        if (y1 >= EPAPER_PAINT_HEIGHT(device)) {
+            y1 = EPAPER_PAINT_HEIGHT(device) - 1;
+        }
+        for (int tx = 0; tx < EPAPER_DIFF_TILES_X; tx++) {
+            if (hash[ty][tx] == epaper_frame_hash[ty][tx]) {
+                continue;
+            }
+            int tx1 = tx;
+            while (tx1 + 1 < EPAPER_DIFF_TILES_X && hash[ty][tx1 + 1] != epaper_frame_hash[ty][tx1 + 1]) {
+                tx1++;
+            }
+            iot_epaper_mark_absolute_dirty(device, tx * tile_width, y0, (tx1 + 1) * tile_width - 1, y1);
+            changed += tx1 - tx + 1;
+            tx = tx1;
+        }
+    }
+    return changed;
+}
+
+void iot_epaper_invalidate_frame(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    epaper_frame_hash_valid = false;
+    epaper_controller.ram_hashed = false;
+    device->ram_valid = false;
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_set_refresh_mode(epaper_handle_t dev, epaper_refresh_mode_t mode)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    device->refresh_mode = mode;
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_set_full_refresh_interval(epaper_handle_t dev, int partial_refreshes)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    device->full_refresh_interval = partial_refreshes;
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_mark_dirty(epaper_handle_t dev, int x0, int y0, int x1, int y1)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
-    if (frame_buffer == NULL) {
-        frame_buffer = device->paint.image;
+    epaper_rect_t rect = {
+        x1 > x0 ? x0 : x1, y1 > y0 ? y0 : y1,
+        x1 > x0 ? x1 : x0, y1 > y0 ? y1 : y0,
+    };
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    if (iot_epaper_map_rect(device, &rect)) {
+        if (rect.x1 >= EPAPER_PAINT_WIDTH(device)) {
+            rect.x1 = EPAPER_PAINT_WIDTH(device) - 1;
+        }
+        if (rect.y1 >= EPAPER_PAINT_HEIGHT(device)) {
+            rect.y1 = EPAPER_PAINT_HEIGHT(device) - 1;
+        }
+        if (rect.x0 <= rect.x1 && rect.y0 <= rect.y1) {
+            iot_epaper_mark_absolute_dirty(device, rect.x0, rect.y0, rect.x1, rect.y1);
+        }
     }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_set_temperature(epaper_handle_t dev, int temperature)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    if (frame_buffer != NULL) {
+    device->temperature = temperature;
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
 
-        iot_epaper_set_lut(dev);
+/* Whether the next refresh should be partial, see iot_epaper_set_full_refresh_interval()
+ */
+static bool iot_epaper_partial_refresh_due(epaper_dev_t* device)
+{
+    return device->refresh_mode == E_PAPER_REFRESH_PARTIAL
+            && epaper_partial_refresh_count < device->full_refresh_interval;
+}
 
-        // configure ePaper's memory to send data
-        iot_set_ram_area(dev, 0, 0, EPD_WIDTH-1, EPD_HEIGHT-1);
-        iot_set_ram_address_counter(dev, 0, 0);
+/* Refresh the screen with the content of controller RAM
+ * This returns once the refresh is started.
+ */
+static void iot_epaper_start_refresh(epaper_handle_t dev, bool partial)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    const uint8_t* lut = epaper_lut_partial_sequence;
 
-        // send image data
+    if (partial == false) {
+        int i = 0;
+        while (device->temperature < epaper_lut_full_by_temperature[i].min_temperature) {
+            i++;
+        }
+        lut = epaper_lut_full_by_temperature[i].sequence;
+    }
+    // the controller keeps the LUT until reset, also in standby during deep sleep
+    if (epaper_controller.lut != lut) {
+        iot_epaper_send_sequence(dev, lut, EPAPER_LUT_SEQUENCE_SIZE);
+        epaper_controller.lut = lut;
+    }
+    iot_epaper_send_sequence(dev, epaper_refresh_sequence, sizeof(epaper_refresh_sequence));
+    device->refresh_pending = true;
+
+    if (partial) {
+        epaper_partial_refresh_count++;
+    } else {
+        epaper_partial_refresh_count = 0;
+    }
+}
+
+/* Draw the display list into the band of frame rows from y0 on
+ * The band starts blank, as the frame does after iot_epaper_clean_paint(dev, UNCOLORED).
+ */
+static void iot_epaper_render_band(epaper_dev_t* device, int y0)
+{
+    device->band_y0 = y0;
+    device->band_y1 = y0 + device->band_rows - 1;
+    if (device->band_y1 >= EPAPER_PAINT_HEIGHT(device)) {
+        device->band_y1 = EPAPER_PAINT_HEIGHT(device) - 1;
+    }
+    memset(device->paint.image, iot_epaper_fill_byte(device, UNCOLORED),
+            (device->band_y1 - y0 + 1) * (EPAPER_PAINT_WIDTH(device) / 8));
+    iot_epaper_replay(device);
+}
+
+/* Transfer the display list band by band and refresh the screen, see iot_epaper_display_frame_async()
+ * If the screen may already show the frame, the bands are rendered once to compare them,
+ * with changed tiles sent right away if RAM holds the frame on the screen,
+ * and once more to send the whole frame otherwise.
+ */
+static void iot_epaper_display_bands(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    uint32_t frame_hash[EPAPER_DIFF_TILES_Y][EPAPER_DIFF_TILES_X];
+    bool partial = iot_epaper_partial_refresh_due(device);
+    bool hashed = EPAPER_PAINT_WIDTH(device) == EPD_WIDTH && EPAPER_PAINT_HEIGHT(device) == EPD_HEIGHT;
+    bool compare = hashed && epaper_frame_hash_valid;
+    bool send_changed = compare && partial && epaper_controller.ram_hashed;
+
+    if (compare) {
+        int changed_tiles = 0;
+        for (int y0 = 0; y0 < EPAPER_PAINT_HEIGHT(device); y0 += device->band_rows) {
+            iot_epaper_render_band(device, y0);
+            iot_epaper_hash_frame(device, device->paint.image, y0, device->band_y1, frame_hash);
+            changed_tiles += iot_epaper_diff_frame(device, frame_hash, y0 / EPAPER_DIFF_TILE_ROWS,
+                    device->band_y1 / EPAPER_DIFF_TILE_ROWS);
+            for (int i = 0; send_changed && i < device->dirty_count; i++) {
+                iot_epaper_write_ram_window(dev, device->paint.image, y0, &device->dirty[i]);
+            }
+        }
+        ESP_LOGD(TAG, "%d tiles changed", changed_tiles);
+        if (changed_tiles == 0) {
+            // the screen already shows this frame
+            device->dirty_count = 0;
+            return;
+        }
+    }
+    if (send_changed == false) {
+        // bands are streamed one after another into the RAM window of the whole frame
+        iot_set_ram_area(dev, 0, 0, EPAPER_PAINT_WIDTH(device) - 1, EPAPER_PAINT_HEIGHT(device) - 1);
+        iot_set_ram_address_counter(dev, 0, 0);
         iot_epaper_send_command(dev, E_PAPER_WRITE_RAM);
-        iot_epaper_send_data(dev, frame_buffer, device->paint.width / 8 * device->paint.height);
-
-        iot_epaper_send_command(dev, 0x3A);     // write number of overscan lines
-        iot_epaper_send_byte(dev, 26);          // 26 dummy lines per gate
-        iot_epaper_send_command(dev, 0x3B);     // write time to write every line
-        iot_epaper_send_byte(dev, 0x08);        // 62us per line
-
-        // configure length of update
-        iot_epaper_send_command(dev, E_PAPER_DRIVER_OUTPUT_CONTROL);
-        iot_epaper_send_byte(dev, 0x27);        // y_len & 0xff
-        iot_epaper_send_byte(dev, 0x01);        // y_len >> 8
-        iot_epaper_send_byte(dev, 0x00);
-
-        iot_epaper_send_command(dev, 0x0f);     // configure starting-line of update
-        iot_epaper_send_byte(dev, 0x00);        // y_start & 0xff
-        iot_epaper_send_byte(dev, 0x00);        // y_start >> 8
-
-        iot_epaper_send_command(dev, 0x22);
-        // bitmapped enabled phases of the update: (in this order)
-        //   80 - enable clock signal
-        //   40 - enable CP
-        //   20 - load temperature value
-        //   10 - load LUT
-        //   08 - initial display
-        //   04 - pattern display
-        //   02 - disable CP
-        //   01 - disable clock signal
-        iot_epaper_send_byte(dev, 0xC7);
-        // start update
-        iot_epaper_send_command(dev, 0x20);
+        for (int y0 = 0; y0 < EPAPER_PAINT_HEIGHT(device); y0 += device->band_rows) {
+            iot_epaper_render_band(device, y0);
+            if (hashed) {
+                iot_epaper_hash_frame(device, device->paint.image, y0, device->band_y1, frame_hash);
+            }
+            iot_epaper_send_data(dev, device->paint.image,
+                    (device->band_y1 - y0 + 1) * (EPAPER_PAINT_WIDTH(device) / 8));
+        }
+    }
 
-        iot_epaper_wait_idle(dev);
+    iot_epaper_start_refresh(dev, partial);
+    device->ram_valid = false;
+    device->ram_image = NULL;
+    device->dirty_count = 0;
+    if (hashed) {
+        memcpy(epaper_frame_hash, frame_hash, sizeof(epaper_frame_hash));
+    }
+    epaper_frame_hash_valid = hashed;
+    epaper_controller.ram_hashed = hashed;
+}
+
+/* Transfer a frame to the display and refresh the screen, see iot_epaper_display_frame_async()
+ * 'own' is true for a frame of the device, to which areas marked changed apply.
+ */
+static void iot_epaper_transfer_frame(epaper_handle_t dev, const unsigned char* frame_buffer, bool own)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    epaper_rect_t whole_frame = { 0, 0, EPAPER_PAINT_WIDTH(device) - 1, EPAPER_PAINT_HEIGHT(device) - 1 };
+    const epaper_rect_t* windows = device->dirty;
+    uint32_t frame_hash[EPAPER_DIFF_TILES_Y][EPAPER_DIFF_TILES_X];
+    bool partial = iot_epaper_partial_refresh_due(device);
+    bool hashed = iot_epaper_hash_frame(device, frame_buffer, 0, EPAPER_PAINT_HEIGHT(device) - 1, frame_hash);
+    bool ram_valid = device->ram_valid;
+
+    if (hashed && epaper_frame_hash_valid) {
+        int changed_tiles = iot_epaper_diff_frame(device, frame_hash, 0, EPAPER_DIFF_TILES_Y - 1);
+        ESP_LOGD(TAG, "%d tiles changed", changed_tiles);
+        if (changed_tiles == 0) {
+            // the screen already shows this frame
+            return;
+        }
+        // changed tiles are enough also after warm start, if RAM still holds the frame
+        ram_valid = epaper_controller.ram_hashed;
+    }
+    int window_count = device->dirty_count;
+    if (partial == false || ram_valid == false || own == false) {
+        windows = &whole_frame;
+        window_count = 1;
+    }
+    if (window_count == 0) {
+        ESP_LOGD(TAG, "nothing changed since the last update");
+        return;
+    }
+
+    // send image data
+    for (int i = 0; i < window_count; i++) {
+        iot_epaper_write_ram_window(dev, frame_buffer, 0, &windows[i]);
+    }
+
+    iot_epaper_start_refresh(dev, partial);
+    device->ram_valid = own;
+    device->ram_image = NULL;
+    device->dirty_count = 0;
+    if (hashed) {
+        memcpy(epaper_frame_hash, frame_hash, sizeof(epaper_frame_hash));
+    }
+    epaper_frame_hash_valid = hashed;
+    epaper_controller.ram_hashed = hashed;
+}
+
+/* Mark areas changed, in addition to those marked already */
+static void iot_epaper_add_dirty(epaper_dev_t* device, const epaper_rect_t* rects, int count)
+{
+    for (int i = 0; i < count; i++) {
+        iot_epaper_mark_absolute_dirty(device, rects[i].x0, rects[i].y0, rects[i].x1, rects[i].y1);
+    }
+}
+
+/* Display the frame buffer with double buffering, see epaper_conf_t.double_buffer
+ * While the controller still refreshes, the frame is copied to the front buffer,
+ * replacing a frame queued before, and sent once the controller is idle.
+ */
+static void iot_epaper_display_double_buffered(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+
+    if (device->refresh_pending && device->backend->is_busy(device->backend_ctx)) {
+        epaper_rect_t changed[EPAPER_DIRTY_RECTS_MAX];
+        int changed_count = device->dirty_count;
+
+        memcpy(device->front, device->paint.image, EPAPER_PAINT_WIDTH(device) / 8 * EPAPER_PAINT_HEIGHT(device));
+        // areas to send are those of the frame queued before and changed since
+        memcpy(changed, device->dirty, sizeof(changed));
+        memcpy(device->dirty, device->queued_dirty, sizeof(device->dirty));
+        device->dirty_count = device->queued ? device->queued_dirty_count : 0;
+        iot_epaper_add_dirty(device, changed, changed_count);
+        memcpy(device->queued_dirty, device->dirty, sizeof(device->queued_dirty));
+        device->queued_dirty_count = device->dirty_count;
+        device->dirty_count = 0;
+        device->queued = true;
+        return;
+    }
+    if (device->queued) {
+        // the frame buffer is newer than the queued frame, which is dropped
+        iot_epaper_add_dirty(device, device->queued_dirty, device->queued_dirty_count);
+        device->queued = false;
+    }
+    iot_epaper_transfer_frame(dev, device->paint.image, true);
+}
+
+/* Send the frame queued by double buffering, once the controller is idle
+ * Areas changed in the frame buffer since it was queued stay marked for the next update.
+ */
+static void iot_epaper_send_queued(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    epaper_rect_t changed[EPAPER_DIRTY_RECTS_MAX];
+
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    if (device->queued) {
+        int changed_count = device->dirty_count;
+        device->queued = false;
+        memcpy(changed, device->dirty, sizeof(changed));
+        memcpy(device->dirty, device->queued_dirty, sizeof(device->dirty));
+        device->dirty_count = device->queued_dirty_count;
+        iot_epaper_transfer_frame(dev, device->front, true);
+        memcpy(device->dirty, changed, sizeof(device->dirty));
+        device->dirty_count = changed_count;
     }
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
-void iot_epaper_sleep(epaper_handle_t dev)
+/* This transfers to the display the image frame and refreshes the screen
+ *
+ * The frame is compared tile by tile with the frame shown on the screen
+ * (also before deep sleep) and if nothing changed, the refresh is skipped.
+ * In E_PAPER_REFRESH_PARTIAL mode, only changed areas are transferred
+ * and the screen is refreshed with the partial update LUT.
+ * Every full_refresh_interval partial updates a full update is done instead.
+ * The whole frame is transferred if controller RAM content is not known,
+ * e.g. after reset or after displaying a frame buffer other than paint.image.
+ * This returns once the refresh is started, the frame buffer is already
+ * transferred by then.
+ */
+void iot_epaper_display_frame_async(epaper_handle_t dev, const unsigned char* frame_buffer)
 {
     epaper_dev_t* device = (epaper_dev_t*) dev;
+
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    if (frame_buffer == NULL && device->band_rows > 0) {
+        iot_epaper_display_bands(dev);
+    } else if (frame_buffer == NULL && device->front != NULL) {
+        iot_epaper_display_double_buffered(dev);
+    } else {
+        if (frame_buffer == NULL) {
+            frame_buffer = device->paint.image;
+        }
+        if (frame_buffer != NULL) {
+            iot_epaper_transfer_frame(dev, frame_buffer, frame_buffer == device->paint.image);
+        }
+    }
+    xSemaphoreGiveRecursive(device->spi_mux);
+}
+
+void iot_epaper_display_frame(epaper_handle_t dev, const unsigned char* frame_buffer)
+{
+    iot_epaper_display_frame_async(dev, frame_buffer);
+    iot_epaper_wait_idle(dev);
+}
+
+/* This transfers a compressed image to the display and refreshes the screen
+ *
+ * The image bypasses the frame buffer, so afterwards the frame buffer
+ * is not known to be on the screen nor in controller RAM.
+ */
+void iot_epaper_display_image(epaper_handle_t dev, const epaper_image_t* image)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+
+    if (image->width != EPAPER_PAINT_WIDTH(device) || image->height != EPAPER_PAINT_HEIGHT(device)) {
+        ESP_LOGE(TAG, "image size %dx%d does not match display", image->width, image->height);
+        return;
+    }
     xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
-    iot_epaper_send_command(dev, E_PAPER_DEEP_SLEEP_MODE);
+    bool partial = iot_epaper_partial_refresh_due(device);
+    if (device->ram_image != image) {
+        device->ram_image = iot_epaper_write_ram_image(dev, image) ? image : NULL;
+        if (device->ram_image == NULL) {
+            ESP_LOGW(TAG, "image data truncated");
+        }
+    }
+    iot_epaper_start_refresh(dev, partial);
+    device->ram_valid = false;
+    device->dirty_count = 0;
+    epaper_frame_hash_valid = false;
+    epaper_controller.ram_hashed = false;
+    xSemaphoreGiveRecursive(device->spi_mux);
     iot_epaper_wait_idle(dev);
+}
+
+void iot_epaper_sleep(epaper_handle_t dev)
+{
+    epaper_dev_t* device = (epaper_dev_t*) dev;
+    xSemaphoreTakeRecursive(device->spi_mux, portMAX_DELAY);
+    if (device->pin.warm_start) {
+        // standby keeps the controller state for the next wake up
+        iot_epaper_wait_idle(dev);
+        device->backend->standby(device->backend_ctx);
+        epaper_controller.standby = true;
+    } else {
+        // only hardware reset wakes up the controller
+        iot_epaper_send_sequence(dev, epaper_sleep_sequence, sizeof(epaper_sleep_sequence));
+        epaper_controller.standby = false;
+    }
     xSemaphoreGiveRecursive(device->spi_mux);
 }
 
@@ -29,13 +29,53 @@ typedef enum {
     E_PAPER_ROTATE_270,
 } epaper_rotate_t;
 
+// Display refresh mode
+typedef enum {
+    E_PAPER_REFRESH_FULL,       /*!< full waveform update of the whole screen */
+    E_PAPER_REFRESH_PARTIAL,    /*!< fast update of changed areas, with a periodic full update */
+} epaper_refresh_mode_t;
+
 typedef struct
 {
     uint16_t width;
     uint16_t height;
     const uint8_t *font_table;
+    const uint8_t *glyph_map;   /* glyph number + 1 of each character from ' ' to '~', 0 if not in the font,
+                                   NULL if font_table holds all these characters */
+    bool packed;                /* glyph rows follow each other bit by bit, not padded to whole bytes */
 } epaper_font_t;
 
+/* Image compressed with PackBits, in controller RAM layout
+ * Generate with tools/epaper_image.py from PBM files.
+ */
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;          /* bytes of compressed data */
+    const uint8_t *data;
+} epaper_image_t;
+
+/* Scrolling chart of samples, one pixel column each, the newest on the right
+ * Each column is stored the way E_PAPER_ROTATE_270 lays out a screen column
+ * in the frame buffer, one bit per row, MSB at the top. So a new sample moves
+ * the columns by a memmove() and draws only its own column. Keep the chart
+ * and its plot e.g. in RTC memory to continue it after deep sleep.
+ */
+#define EPAPER_CHART_COLUMN_BYTES(height)       (((height) + 7) / 8)
+#define EPAPER_CHART_PLOT_SIZE(width, height)   ((width) * EPAPER_CHART_COLUMN_BYTES(height))
+
+typedef struct
+{
+    int width;              /* samples shown */
+    int height;             /* pixel rows */
+    int min;                /* value in the bottom row, smaller values are drawn there as well */
+    int max;                /* value in the top row, larger values are drawn there as well */
+    int samples;            /* samples in the plot, up to width */
+    int last_row;           /* row of the newest sample */
+    uint8_t *plot;          /* EPAPER_CHART_PLOT_SIZE(width, height) bytes, the oldest column first */
+} epaper_chart_t;
+
 #define COLORED         0
 #define UNCOLORED       1
 
@@ -87,10 +127,39 @@ typedef struct {
     int width;
     int height;
     bool color_inv;
+    bool warm_start;    /* keep the controller initialized in standby during deep sleep of the ESP32,
+                           so after wake up it is not reset and initialized again, see iot_epaper_sleep() */
+    int band_rows;      /* 0 to draw into a frame buffer, otherwise drawing is recorded in a display list
+                           and rendered in bands of this many rows, rounded up to a multiple of 16,
+                           when the frame is displayed, see iot_epaper_display_frame_async() */
+    bool double_buffer; /* with a second frame buffer, displaying a frame does not wait for the refresh
+                           of the frame before, see iot_epaper_display_frame_async(), not in band mode */
 } epaper_conf_t;
 
 typedef void* epaper_handle_t; /*handle of epaper*/
 
+/* Called when the controller becomes idle, e.g. a refresh is complete */
+typedef void (*epaper_idle_cb_t)(void* arg);
+
+/* Low level access to the display controller
+ * The driver talks to the controller only through these operations,
+ * so it may be used with the SPI bus of the badge or e.g. a simulator.
+ * 'ctx' is the context passed to iot_epaper_create_with_backend().
+ * Transfers may be queued, but the data passed to send() may be reused
+ * once it returns.
+ */
+typedef struct {
+    esp_err_t (*init)(void* ctx, const epaper_conf_t* epconf, bool warm); /*!< configure pins and bus, warm if left in standby() */
+    esp_err_t (*deinit)(void* ctx, bool del_bus);               /*!< release bus and context */
+    void (*reset)(void* ctx);                                   /*!< hardware reset pulse */
+    void (*send)(void* ctx, bool command, const uint8_t* data, int length); /*!< command or data bytes, may be queued */
+    void (*wait_idle)(void* ctx);                               /*!< block while controller is busy */
+    bool (*is_busy)(void* ctx);                                 /*!< controller busy, without blocking */
+    void (*sleep_until_idle)(void* ctx);                        /*!< wait_idle in a low power mode */
+    void (*set_idle_callback)(void* ctx, epaper_idle_cb_t cb, void* arg); /*!< notify end of busy */
+    void (*standby)(void* ctx);                                 /*!< keep controller out of reset during deep sleep */
+} epaper_backend_t;
+
 /**
  * @brief Create and init epaper and return a epaper handle
  *
@@ -102,6 +171,19 @@ typedef void* epaper_handle_t; /*handle of epaper*/
  */
 epaper_handle_t iot_epaper_create(spi_device_handle_t bus, epaper_conf_t * epconf);
 
+/**
+ * @brief Create and init epaper talking to the controller through a backend
+ *
+ * @param backend operations to access the controller
+ * @param ctx backend context, passed to each operation
+ * @param epconf configure struct for epaper device
+ *
+ * @return
+ *     - handle of epaper
+ *     - NULL if the frame or band buffer cannot be allocated or backend init fails
+ */
+epaper_handle_t iot_epaper_create_with_backend(const epaper_backend_t* backend, void* ctx, epaper_conf_t* epconf);
+
 /**
  * @brief   delete epaper handle_t
  *
@@ -117,11 +199,47 @@ esp_err_t iot_epaper_delete(epaper_handle_t dev, bool del_bus);
 /**
  * @brief clear display frame buffer
  *
+ * In band mode, see epaper_conf_t.band_rows, this also drops everything
+ * drawn before from the display list.
+ *
  * @param dev object handle of epaper
  * @param colored to set display color
  */
 void iot_epaper_clean_paint(epaper_handle_t dev, int colored);
 
+/**
+ * @brief fill display frame buffer with a copy of pre-rendered image,
+ *        e.g. static background of a screen
+ *
+ * In band mode the image is copied band by band when the frame is displayed,
+ * so it has to be kept until then, and everything drawn before is dropped
+ * from the display list.
+ *
+ * @param dev object handle of epaper
+ * @param image frame buffer contents, as returned by iot_epaper_get_image()
+ *        with the same color_inv setting
+ */
+void iot_epaper_load_paint(epaper_handle_t dev, const unsigned char* image);
+
+/**
+ * @brief start composing a frame, e.g. a whole screen
+ *
+ * The frame buffer lock is taken once and held until iot_epaper_end_draw(),
+ * so drawing functions called in between do not wait for it, and other
+ * tasks can not draw or display a partly composed frame meanwhile.
+ * Calls may be nested and have to be paired with iot_epaper_end_draw().
+ *
+ * @param dev object handle of epaper
+ */
+void iot_epaper_begin_draw(epaper_handle_t dev);
+
+/**
+ * @brief finish composing a frame started with iot_epaper_begin_draw()
+ *
+ * @param dev object handle of epaper
+ */
+void iot_epaper_end_draw(epaper_handle_t dev);
+
 /**
  * @brief get paint width
  *
@@ -164,6 +282,9 @@ int iot_epaper_get_rotate(epaper_handle_t dev);
 
 /**
  * @brief set paint rotate
+ *
+ * With CONFIG_EPAPER_FIXED_GEOMETRY drawing keeps the configured rotation.
+ *
  * @param dev object handle of epaper
  * @param rotation
  */
@@ -174,6 +295,7 @@ void iot_epaper_set_rotate(epaper_handle_t dev, int rotate);
  * @param dev object handle of epaper
  * @return
  *     - Pointer to display data
+ *     - NULL in band mode, there is no frame buffer
  */
 unsigned char* iot_epaper_get_image(epaper_handle_t dev);
 
@@ -200,6 +322,66 @@ void iot_epaper_draw_string(epaper_handle_t dev, int x, int y, const char* text,
  */
 void iot_epaper_draw_pixel(epaper_handle_t dev, int x, int y, int colored);
 
+/**
+ * @brief   draw bitmap and save on display data array,
+ *          screen will display when call iot_epaper_display_frame function.
+ *
+ * Set bits of the bitmap are drawn in the given color, other pixels are left
+ * as they are. The bitmap is rotated and clipped the same way as pixels
+ * drawn by iot_epaper_draw_pixel(), eight pixels at a time.
+ *
+ * @param  dev object handle of epaper
+ * @param  bitmap rows of (width + 7) / 8 bytes, MSB is the leftmost pixel,
+ *         in band mode kept until the frame is displayed
+ * @param  x point (x) of the top left corner
+ * @param  y point (y) of the top left corner
+ * @param  width bitmap width in pixels
+ * @param  height bitmap height in pixels
+ * @param  colored display color
+ */
+void iot_epaper_blit(epaper_handle_t dev, const uint8_t* bitmap, int x, int y,
+        int width, int height, int colored);
+
+/**
+ * @brief   clear the plot of a chart and set its size and range of values
+ *
+ * @param  chart chart to initialize
+ * @param  plot EPAPER_CHART_PLOT_SIZE(width, height) bytes for the plot
+ * @param  width samples shown, one pixel column each
+ * @param  height pixel rows of the plot
+ * @param  min value drawn in the bottom row
+ * @param  max value drawn in the top row
+ */
+void iot_epaper_chart_init(epaper_chart_t* chart, uint8_t* plot, int width, int height, int min, int max);
+
+/**
+ * @brief   add the newest sample to the chart, the oldest one is dropped
+ *
+ * Columns are moved left by one and only the new column is drawn, joined
+ * with the previous sample by a vertical line. The display is not touched,
+ * draw the chart with iot_epaper_draw_chart().
+ *
+ * @param  chart chart initialized with iot_epaper_chart_init()
+ * @param  value sample, clamped to the range of the chart
+ */
+void iot_epaper_chart_add(epaper_chart_t* chart, int value);
+
+/**
+ * @brief   draw chart and save on display data array,
+ *          screen will display when call iot_epaper_display_frame function.
+ *
+ * The plot replaces whatever is in its rectangle and only this rectangle
+ * is marked changed. With E_PAPER_ROTATE_270 and 90 each column of the plot
+ * is copied into a frame buffer row a byte at a time.
+ *
+ * @param  dev object handle of epaper
+ * @param  chart chart to draw, in band mode kept until the frame is displayed
+ * @param  x point (x) of the top left corner
+ * @param  y point (y) of the top left corner
+ * @param  colored display color of the samples, the background is the other color
+ */
+void iot_epaper_draw_chart(epaper_handle_t dev, const epaper_chart_t* chart, int x, int y, int colored);
+
 /**
  * @brief   draw char and save on display data array,
  *          screen will display when call iot_epaper_display_frame function.
@@ -213,6 +395,19 @@ void iot_epaper_draw_pixel(epaper_handle_t dev, int x, int y, int colored);
 void iot_epaper_draw_char(epaper_handle_t dev, int x, int y, char ascii_char,
         epaper_font_t* font, int colored);
 
+/**
+ * @brief   enable or disable the glyph cache (enabled by default, except in band mode)
+ *
+ *          Glyphs of each font are transposed on first use into the frame buffer
+ *          layout of the current rotation, so characters are drawn with whole
+ *          bytes instead of pixel by pixel. Only glyphs of characters drawn take
+ *          memory, about 40 bytes each for font 20. Disabling the cache frees it.
+ *
+ * @param   dev object handle of epaper
+ * @param   enable true to draw characters from the cache
+ */
+void iot_epaper_set_glyph_cache(epaper_handle_t dev, bool enable);
+
 /**
  * @brief   draw line start on point(x0,y0) end on point(x1,y1) and save on display data array,
  *          screen will display when call iot_epaper_display_frame function.
@@ -306,11 +501,51 @@ void iot_epaper_draw_filled_circle(epaper_handle_t dev, int x, int y,
         int radius, int colored);
 
 /**
- * @brief  wait until idle
+ * @brief  wait until idle, also after a frame queued by double buffering is displayed
  * @param  dev object handle of epaper
  */
 void iot_epaper_wait_idle(epaper_handle_t dev);
 
+/**
+ * @brief  check if the display is still busy, e.g. refreshing the screen
+ *
+ * If it is not, a frame queued by double buffering is sent, see
+ * iot_epaper_display_frame_async(), and the display is busy again.
+ *
+ * @param  dev object handle of epaper
+ *
+ * @return
+ *     - true if busy
+ */
+bool iot_epaper_is_busy(epaper_handle_t dev);
+
+/**
+ * @brief  wait until idle with the CPU in light sleep,
+ *         woken up by the busy line of the display
+ *
+ * Light sleep stops all tasks, so use it when there is nothing else to do,
+ * and not while Wi-Fi or BT is on. A frame queued by double buffering
+ * is displayed and waited for as well.
+ *
+ * @param  dev object handle of epaper
+ */
+void iot_epaper_light_sleep_until_idle(epaper_handle_t dev);
+
+/**
+ * @brief  set function called when the display becomes idle,
+ *         e.g. to signal completion of iot_epaper_display_frame_async()
+ *
+ * The function is called from the busy line interrupt, so it should be
+ * short, placed in IRAM and use only ISR safe FreeRTOS calls.
+ * If the wait was done by iot_epaper_light_sleep_until_idle(), it is
+ * called from that function instead.
+ *
+ * @param  dev object handle of epaper
+ * @param  cb function to call, or NULL to disable
+ * @param  arg argument passed to the function
+ */
+void iot_epaper_set_idle_callback(epaper_handle_t dev, epaper_idle_cb_t cb, void* arg);
+
 /**
  * @brief  reset device
  *
@@ -321,16 +556,127 @@ void iot_epaper_reset(epaper_handle_t dev);
 /**
  * @brief dispaly frame, refresh screen
  *
+ * Refresh is skipped if the frame is the same as shown on the screen,
+ * also when it was displayed before deep sleep. In E_PAPER_REFRESH_PARTIAL
+ * mode only changed areas are transferred to the display and refreshed
+ * with the partial update waveform.
+ *
  * @param dev object handle of epaper
+ * @param frame_buffer image to display, or NULL to display the frame buffer of the device
  */
 void iot_epaper_display_frame(epaper_handle_t dev, const unsigned char* frame_buffer);
 
+/**
+ * @brief display a compressed image, e.g. a splash screen
+ *
+ * The image is decompressed in small chunks straight to the display,
+ * bypassing the frame buffer. The same image displayed again is not
+ * transferred again, only the screen is refreshed.
+ *
+ * @param dev object handle of epaper
+ * @param image image of the size of the display
+ */
+void iot_epaper_display_image(epaper_handle_t dev, const epaper_image_t* image);
+
+/**
+ * @brief start displaying a frame and return without waiting for the refresh
+ *
+ * Works like iot_epaper_display_frame(), but returns as soon as
+ * the refresh has been started. Use iot_epaper_is_busy(),
+ * iot_epaper_wait_idle() or the idle callback to learn when it is complete.
+ * The frame buffer may be drawn again immediately. Other functions
+ * talking to the display first wait until the refresh is complete.
+ *
+ * In band mode, see epaper_conf_t.band_rows, the display list is replayed
+ * into a buffer of a few rows, one band after another, and each band is
+ * transferred before the next one is rendered. Bands start blank. If the
+ * screen may already show the frame, it is rendered twice: first only
+ * to compare it with the screen, then to transfer it, unless changed
+ * tiles are transferred already by the first pass. The display list is
+ * kept, so drawing more adds to the same frame as with a frame buffer.
+ *
+ * With epaper_conf_t.double_buffer, the frame buffer displayed while the
+ * screen still refreshes is copied to the second buffer and this returns
+ * without waiting. The copy replaces a frame copied before and not sent yet,
+ * and is sent by the first of iot_epaper_is_busy(), iot_epaper_wait_idle(),
+ * iot_epaper_light_sleep_until_idle() or another display call that finds
+ * the refresh complete. So the next frame is drawn during the refresh
+ * and the screen shows the latest frame as soon as possible.
+ *
+ * @param dev object handle of epaper
+ * @param frame_buffer image to display, or NULL to display the frame buffer of the device
+ */
+void iot_epaper_display_frame_async(epaper_handle_t dev, const unsigned char* frame_buffer);
+
+/**
+ * @brief   forget what is shown on the screen, so the next
+ *          iot_epaper_display_frame() transfers and refreshes the whole frame,
+ *          even if it is the same as the frame displayed before
+ *
+ * @param   dev object handle of epaper
+ */
+void iot_epaper_invalidate_frame(epaper_handle_t dev);
+
+/**
+ * @brief   set how iot_epaper_display_frame() refreshes the screen
+ *
+ * @param   dev object handle of epaper
+ * @param   mode E_PAPER_REFRESH_FULL (default) or E_PAPER_REFRESH_PARTIAL
+ */
+void iot_epaper_set_refresh_mode(epaper_handle_t dev, epaper_refresh_mode_t mode);
+
+/**
+ * @brief   set number of partial refreshes after which a full refresh is done
+ *          to clear ghosting, in E_PAPER_REFRESH_PARTIAL mode.
+ *          The count is retained during deep sleep.
+ *
+ * @param   dev object handle of epaper
+ * @param   partial_refreshes number of partial refreshes in a row (default 10)
+ */
+void iot_epaper_set_full_refresh_interval(epaper_handle_t dev, int partial_refreshes);
+
+/**
+ * @brief   set temperature of the panel, for the waveform of full refreshes
+ *
+ *          With CONFIG_EPAPER_TEMPERATURE_WAVEFORMS, the warmer the panel, the shorter
+ *          the waveform that fully refreshes it. Otherwise, and until set, the vendor
+ *          full waveform is used. Partial refreshes use the same waveform at any temperature.
+ *
+ * @param   dev object handle of epaper
+ * @param   temperature in degrees C, e.g. ambient temperature measured shortly before
+ */
+void iot_epaper_set_temperature(epaper_handle_t dev, int temperature);
+
+/**
+ * @brief   mark rectangle point(x0,y0) (x1,y1) as changed, so it is transferred
+ *          to the display by the next partial refresh. Drawing functions of this
+ *          driver do it on their own, this is for changes done directly
+ *          in the buffer returned by iot_epaper_get_image().
+ *
+ * @param  dev object handle of epaper
+ * @param  x0 point(x0,y0)
+ * @param  y0 point(x0,y0)
+ * @param  x1 point(x1,y1)
+ * @param  y1 point(x1,y1)
+ */
+void iot_epaper_mark_dirty(epaper_handle_t dev, int x0, int y0, int x1, int y1);
+
 /**
  * @brief   After this command is transmitted, the chip would enter the deep-sleep mode to save power.
  * The deep sleep mode would return to standby by hardware reset. The only one parameter is a
  * check code, the command would be executed if check code = 0xA5.
  * You can use iot_epaper_reset() to awaken and EPD_Init() to initialize
  *
+ * With epaper_conf_t.warm_start the controller is left in standby instead,
+ * keeping its registers, LUT and RAM. Created after wake up, the driver then
+ * skips reset and initialization, loads the LUT only if another one is needed
+ * and transfers only areas of the frame that changed. This saves about 12 ms
+ * per wake up at 20 MHz: the 10 ms power up delay, the reset pulses and a whole
+ * frame of 4736 bytes, against a refresh of at least 380 ms. In standby the
+ * controller draws more current than in deep sleep, and the reset and chip
+ * select pins are held during deep sleep of the ESP32. Measure both on the
+ * panel used before enabling it; deep sleep is the default.
+ *
  * @param   dev object handle of epaper
  */
 void iot_epaper_sleep(epaper_handle_t dev);
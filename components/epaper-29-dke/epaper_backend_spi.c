@@ -0,0 +1,360 @@
+// Copyright 2015-2017 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* SPI / GPIO backend of the ePaper driver, used on the badge */
+
+#include <stdlib.h>
+#include <string.h>
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "esp_sleep.h"
+
+#include "epaper-29-dke.h"
+
+static const char* TAG = "ePaper SPI";
+
+#define EPAPER_QUE_SIZE_DEFAULT 10
+// Transfers up to this length are copied into the transaction and queued
+// without waiting, longer ones are sent from the caller's buffer
+#define EPAPER_QUEUED_DATA_MAX  4
+// Busy line is checked again after this time, in case its interrupt is missed
+#define EPAPER_BUSY_CHECK_PERIOD_MS 100
+
+// LCD data/command
+typedef struct {
+    uint8_t dc_io;
+    uint8_t dc_level;
+} epaper_dc_t;
+
+/* Queued transaction, with the D/C level set by the pre-transfer callback */
+typedef struct {
+    spi_transaction_t trans;
+    epaper_dc_t dc;
+} epaper_spi_slot_t;
+
+typedef struct {
+    spi_device_handle_t bus;
+    epaper_conf_t pin;      /* EPD properties */
+    epaper_spi_slot_t slots[EPAPER_QUE_SIZE_DEFAULT];
+    int next_slot;          /* slot of the next transaction */
+    int queued;             /* transactions queued and not collected yet */
+    xSemaphoreHandle idle_sem;  /* given by the busy line interrupt */
+    epaper_idle_cb_t idle_cb;
+    void* idle_cb_arg;
+} epaper_spi_t;
+
+/* This function is called (in irq context!) just before a transmission starts.
+ * It will set the D/C line to the value indicated in the user field
+ */
+static void iot_epaper_pre_transfer_callback(spi_transaction_t *t)
+{
+    epaper_dc_t *dc = (epaper_dc_t *) t->user;
+    gpio_set_level((int)dc->dc_io, (int)dc->dc_level);
+}
+
+/* Collect the oldest queued transaction, waiting until it is complete */
+static void iot_epaper_collect(epaper_spi_t* spi)
+{
+    spi_transaction_t* t;
+    esp_err_t ret = spi_device_get_trans_result(spi->bus, &t, portMAX_DELAY);
+    assert(ret == ESP_OK);
+    spi->queued--;
+}
+
+/* Wait until all queued transactions are on the bus */
+static void iot_epaper_flush(epaper_spi_t* spi)
+{
+    while (spi->queued > 0) {
+        iot_epaper_collect(spi);
+    }
+}
+
+/* Queue transfer of command or data bytes
+ * Short transfers are copied and left in the queue, so a sequence of commands
+ * and parameters goes out back to back, with D/C switched by the SPI driver.
+ * Longer ones are sent from 'data' directly and waited for.
+ */
+static void iot_epaper_send(epaper_spi_t* spi, const uint8_t *data, int len, uint8_t dc_level)
+{
+    esp_err_t ret;
+    if (len == 0) {
+        return;    // no need to send anything
+    }
+    if (spi->queued == EPAPER_QUE_SIZE_DEFAULT) {
+        // slots are reused in order, the next one is the oldest queued
+        iot_epaper_collect(spi);
+    }
+    epaper_spi_slot_t* slot = &spi->slots[spi->next_slot];
+    spi->next_slot = (spi->next_slot + 1) % EPAPER_QUE_SIZE_DEFAULT;
+
+    memset(&slot->trans, 0, sizeof(slot->trans));
+    slot->trans.length = len * 8;  // Len is in bytes, transaction length is in bits.
+    slot->trans.user = (void *) &slot->dc;
+    slot->dc.dc_io = spi->pin.dc_pin;
+    slot->dc.dc_level = dc_level;
+    if (len <= EPAPER_QUEUED_DATA_MAX) {
+        slot->trans.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(slot->trans.tx_data, data, len);
+    } else {
+        slot->trans.tx_buffer = data;
+    }
+    ret = spi_device_queue_trans(spi->bus, &slot->trans, portMAX_DELAY);
+    assert(ret == ESP_OK);
+    spi->queued++;
+    if (len > EPAPER_QUEUED_DATA_MAX) {
+        iot_epaper_flush(spi);
+    }
+}
+
+/* Busy line became inactive, i.e. the controller is idle */
+static void IRAM_ATTR iot_epaper_busy_isr(void* arg)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) arg;
+    BaseType_t task_woken = pdFALSE;
+
+    xSemaphoreGiveFromISR(spi->idle_sem, &task_woken);
+    if (spi->idle_cb) {
+        spi->idle_cb(spi->idle_cb_arg);
+    }
+    if (task_woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static gpio_int_type_t iot_epaper_busy_end_edge(const epaper_conf_t* pin)
+{
+    return pin->busy_active_level ? GPIO_INTR_NEGEDGE : GPIO_INTR_POSEDGE;
+}
+
+static esp_err_t iot_epaper_busy_intr_init(epaper_spi_t* spi)
+{
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret == ESP_FAIL || ret == ESP_ERR_INVALID_STATE) {
+        // already installed, e.g. by the badge
+        ret = ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    gpio_set_intr_type(spi->pin.busy_pin, iot_epaper_busy_end_edge(&spi->pin));
+    return gpio_isr_handler_add(spi->pin.busy_pin, iot_epaper_busy_isr, spi);
+}
+
+static void iot_epaper_gpio_init(const epaper_conf_t * pin, bool warm)
+{
+    // after deep sleep in standby, the controller is kept out of reset, see standby()
+    gpio_pad_select_gpio(pin->reset_pin);
+    gpio_set_direction(pin->reset_pin, GPIO_MODE_OUTPUT);
+    gpio_set_level(pin->reset_pin, warm ? (~pin->rst_active_level) & 0x1 : pin->rst_active_level);
+    gpio_hold_dis(pin->reset_pin);
+    gpio_hold_dis(pin->cs_pin);
+    gpio_pad_select_gpio(pin->dc_pin);
+    gpio_set_direction(pin->dc_pin, GPIO_MODE_OUTPUT);
+    gpio_set_level(pin->dc_pin, 1);
+    if (warm == false) {
+        ets_delay_us(10000);
+    }
+    gpio_set_level(pin->dc_pin, 0);
+    gpio_pad_select_gpio(pin->busy_pin);
+    gpio_set_direction(pin->busy_pin, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(pin->busy_pin, GPIO_PULLUP_ONLY);
+}
+
+static esp_err_t iot_epaper_spi_init(spi_device_handle_t *e_spi, const epaper_conf_t *pin)
+{
+    esp_err_t ret;
+    spi_bus_config_t buscfg = {
+        .miso_io_num = -1,  // MISO not used, we are transferring to the slave only
+        .mosi_io_num = pin->mosi_pin,
+        .sclk_io_num = pin->sck_pin,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        // The maximum size sent below covers the case
+        // when the whole frame buffer is transferred to the slave
+        .max_transfer_sz = EPD_WIDTH * EPD_HEIGHT / 8,
+    };
+    spi_device_interface_config_t devcfg = {
+        .clock_speed_hz = pin->clk_freq_hz,
+        .mode = 0,  // SPI mode 0
+        .spics_io_num = pin->cs_pin,
+        // transactions queued by iot_epaper_send() at a time
+        .queue_size = EPAPER_QUE_SIZE_DEFAULT,
+        // We are sending only in one direction (to the ePaper slave)
+        .flags = (SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE),
+        //Specify pre-transfer callback to handle D/C line
+        .pre_cb = iot_epaper_pre_transfer_callback,
+    };
+    ret = spi_bus_initialize(pin->spi_host, &buscfg, 2);
+    assert(ret == ESP_OK);
+    ret = spi_bus_add_device(pin->spi_host, &devcfg, e_spi);
+    assert(ret == ESP_OK);
+    return ret;
+}
+
+static esp_err_t iot_epaper_spi_backend_init(void* ctx, const epaper_conf_t* epconf, bool warm)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+    esp_err_t ret = ESP_OK;
+
+    spi->pin = *epconf;
+    spi->idle_sem = xSemaphoreCreateBinary();
+    if (spi->idle_sem == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    iot_epaper_gpio_init(epconf, warm);
+    ret = iot_epaper_busy_intr_init(spi);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "busy interrupt init fail %d", ret);
+        vSemaphoreDelete(spi->idle_sem);
+        return ret;
+    }
+    ESP_LOGD(TAG, "gpio init ok");
+    if (spi->bus == NULL) {
+        ret = iot_epaper_spi_init(&spi->bus, epconf);
+        ESP_LOGD(TAG, "spi init ok");
+    }
+    return ret;
+}
+
+static esp_err_t iot_epaper_spi_backend_deinit(void* ctx, bool del_bus)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    iot_epaper_flush(spi);
+    gpio_isr_handler_remove(spi->pin.busy_pin);
+    gpio_set_intr_type(spi->pin.busy_pin, GPIO_INTR_DISABLE);
+    spi_bus_remove_device(spi->bus);
+    if (del_bus) {
+        spi_bus_free(spi->pin.spi_host);
+    }
+    vSemaphoreDelete(spi->idle_sem);
+    free(spi);
+    return ESP_OK;
+}
+
+static void iot_epaper_spi_backend_reset(void* ctx)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    iot_epaper_flush(spi);
+    gpio_set_level((gpio_num_t) spi->pin.reset_pin, (~(spi->pin.rst_active_level)) & 0x1);
+    ets_delay_us(200);
+    gpio_set_level((gpio_num_t) spi->pin.reset_pin, (spi->pin.rst_active_level) & 0x1);             //module reset
+    ets_delay_us(200);
+    gpio_set_level((gpio_num_t) spi->pin.reset_pin, (~(spi->pin.rst_active_level)) & 0x1);
+}
+
+static void iot_epaper_spi_backend_send(void* ctx, bool command, const uint8_t* data, int length)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    iot_epaper_send(spi, data, length, command ? spi->pin.dc_lev_cmd : spi->pin.dc_lev_data);
+}
+
+static bool iot_epaper_spi_backend_is_busy(void* ctx)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    // busy line reflects commands that reached the controller only
+    iot_epaper_flush(spi);
+    return gpio_get_level((gpio_num_t) spi->pin.busy_pin) == spi->pin.busy_active_level;
+}
+
+static void iot_epaper_spi_backend_wait_idle(void* ctx)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    // the semaphore may be left given by an earlier busy period,
+    // so the line is checked again after each wake up
+    while (iot_epaper_spi_backend_is_busy(ctx)) {
+        xSemaphoreTake(spi->idle_sem, EPAPER_BUSY_CHECK_PERIOD_MS / portTICK_PERIOD_MS);
+    }
+}
+
+static void iot_epaper_spi_backend_sleep_until_idle(void* ctx)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+    gpio_num_t busy_pin = (gpio_num_t) spi->pin.busy_pin;
+
+    if (iot_epaper_spi_backend_is_busy(ctx) == false) {
+        return;
+    }
+    // wake up on the idle level, with the edge interrupt off meanwhile
+    gpio_intr_disable(busy_pin);
+    gpio_wakeup_enable(busy_pin, spi->pin.busy_active_level ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    while (iot_epaper_spi_backend_is_busy(ctx)) {
+        esp_light_sleep_start();
+    }
+    gpio_wakeup_disable(busy_pin);
+    gpio_set_intr_type(busy_pin, iot_epaper_busy_end_edge(&spi->pin));
+    gpio_intr_enable(busy_pin);
+    if (spi->idle_cb) {
+        spi->idle_cb(spi->idle_cb_arg);
+    }
+}
+
+static void iot_epaper_spi_backend_set_idle_callback(void* ctx, epaper_idle_cb_t cb, void* arg)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    gpio_intr_disable((gpio_num_t) spi->pin.busy_pin);
+    spi->idle_cb = cb;
+    spi->idle_cb_arg = arg;
+    gpio_intr_enable((gpio_num_t) spi->pin.busy_pin);
+}
+
+static void iot_epaper_spi_backend_standby(void* ctx)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) ctx;
+
+    // reset and chip select lines would float during deep sleep, so they are held
+    // at inactive levels, until released by iot_epaper_gpio_init() after wake up
+    iot_epaper_flush(spi);
+    gpio_hold_en((gpio_num_t) spi->pin.reset_pin);
+    gpio_hold_en((gpio_num_t) spi->pin.cs_pin);
+    gpio_deep_sleep_hold_en();
+}
+
+static const epaper_backend_t epaper_spi_backend = {
+    .init = iot_epaper_spi_backend_init,
+    .deinit = iot_epaper_spi_backend_deinit,
+    .reset = iot_epaper_spi_backend_reset,
+    .send = iot_epaper_spi_backend_send,
+    .wait_idle = iot_epaper_spi_backend_wait_idle,
+    .is_busy = iot_epaper_spi_backend_is_busy,
+    .sleep_until_idle = iot_epaper_spi_backend_sleep_until_idle,
+    .set_idle_callback = iot_epaper_spi_backend_set_idle_callback,
+    .standby = iot_epaper_spi_backend_standby,
+};
+
+epaper_handle_t iot_epaper_create(spi_device_handle_t bus, epaper_conf_t *epconf)
+{
+    epaper_spi_t* spi = (epaper_spi_t*) calloc(1, sizeof(epaper_spi_t));
+    if (spi == NULL) {
+        return NULL;
+    }
+    spi->bus = bus;
+    epaper_handle_t dev = iot_epaper_create_with_backend(&epaper_spi_backend, spi, epconf);
+    if (dev == NULL) {
+        free(spi);
+    }
+    return dev;
+}
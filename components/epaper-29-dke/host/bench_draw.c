@@ -0,0 +1,359 @@
+// Host benchmark of drawing primitives of the epaper-29-dke driver.
+//
+// Each primitive is drawn repeatedly at E_PAPER_ROTATE_270, as on the badge,
+// and each screen of update_display() of the altimeter, its labels, status
+// line and values, at all four rotations, or only the one of
+// CONFIG_EPAPER_FIXED_GEOMETRY in the bench_draw_fixed build.
+// Reported are nanoseconds per operation and frame buffer bytes
+// the operation changes on a blank frame.
+// Last, the peak heap the driver takes to display screens 0 to 4
+// is reported with a whole frame buffer and in band mode, each with
+// and without the glyph cache, counted by malloc wrappers (see Makefile).
+// Output is one line per operation, to be compared between commits.
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "epaper-29-dke.h"
+#include "epaper_fonts.h"
+#include "epaper_sim.h"
+
+#define BENCH_MIN_SECONDS   0.1
+// Rows of a band, as the altimeter sets
+#define BENCH_BAND_ROWS     16
+#define BENCH_FRAME_BYTES   (EPD_WIDTH / 8 * EPD_HEIGHT)
+
+typedef struct {
+    const char* name;
+    void (*draw)(epaper_handle_t dev);
+} bench_op_t;
+
+typedef struct {
+    int x;
+    int y;
+    const char* text;
+} bench_text_t;
+
+// Labels and example values of screens 0 to 4, see update_display(), all in font 20
+static const bench_text_t screen_text[5][8] = {
+    {
+        { 10, 25, "Climbed" }, { 10, 52, "Heart Rate" }, { 10, 79, "Battery" }, { 10, 106, "Up Time" },
+        { 155, 25, "  4504 m" }, { 155, 52, "   142 BPM" }, { 155, 79, "  3.91 V" }, { 127, 106, " 2:20:05" },
+    }, {
+        { 7, 25, "Climb Top" }, { 7, 52, "Time/Climb" }, { 7, 79, "Floors Cnt" }, { 7, 106, "Meters Cnt" },
+        { 155, 25, "        3" }, { 170, 52, " 0:46:41" }, { 155, 79, "      126" }, { 155, 106, "      409" },
+    }, {
+        { 7, 25, "Pressure" }, { 7, 52, "Rf Pressure" }, { 7, 79, "Altitude" }, { 7, 106, "Temperature" },
+        { 155, 25, "  95210 Pa" }, { 155, 52, " 101325 Pa" }, { 155, 79, "  521.4 m" }, { 155, 106, "   23.5 C" },
+    }, {
+        { 7, 25, "BMP180" }, { 7, 52, "Polar H7" }, { 7, 79, "ThingSpeak" }, { 7, 106, "OpenWeather" },
+        { 155, 25, "     0 Err" }, { 155, 52, "     2 Err" }, { 155, 79, "     1 Err" }, { 155, 106, "     0 Err" },
+    }, {
+        { 7, 25, "Wi-Fi Conn" }, { 7, 52, "Batt Charging" }, { 7, 79, "Descent" }, { 7, 106, "Climb Down" },
+        { 155, 25, "     1 Err" }, { 253, 52, "No" }, { 155, 79, "   498 m" }, { 155, 106, "     3" },
+    },
+};
+
+static uint8_t icon[24][3];
+static epaper_chart_t chart;
+static uint8_t chart_plot[EPAPER_CHART_PLOT_SIZE(192, 48)];
+static int chart_value;
+
+// Heap in use and its peak, with the rounding of the allocator
+static long heap_in_use;
+static long heap_peak;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+static void heap_add(void* ptr, long bytes)
+{
+    if (ptr != NULL) {
+        heap_in_use += bytes;
+        if (heap_in_use > heap_peak) {
+            heap_peak = heap_in_use;
+        }
+    }
+}
+
+void* __wrap_malloc(size_t size)
+{
+    void* ptr = __real_malloc(size);
+    heap_add(ptr, malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    void* ptr = __real_calloc(count, size);
+    heap_add(ptr, malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    long old_bytes = malloc_usable_size(ptr);
+    void* new_ptr = __real_realloc(ptr, size);
+    if (new_ptr != NULL) {
+        heap_in_use -= old_bytes;
+        heap_add(new_ptr, malloc_usable_size(new_ptr));
+    }
+    return new_ptr;
+}
+
+void __wrap_free(void* ptr)
+{
+    heap_in_use -= malloc_usable_size(ptr);
+    __real_free(ptr);
+}
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void draw_clean_paint(epaper_handle_t dev)
+{
+    iot_epaper_clean_paint(dev, COLORED);
+}
+
+static void draw_string_8(epaper_handle_t dev)
+{
+    iot_epaper_draw_string(dev, 10, 60, "Heart Rate", &epaper_font_8, COLORED);
+}
+
+static void draw_string_12(epaper_handle_t dev)
+{
+    iot_epaper_draw_string(dev, 10, 60, "Heart Rate", &epaper_font_12, COLORED);
+}
+
+static void draw_string_16(epaper_handle_t dev)
+{
+    iot_epaper_draw_string(dev, 10, 60, "Heart Rate", &epaper_font_16, COLORED);
+}
+
+static void draw_string_20(epaper_handle_t dev)
+{
+    iot_epaper_draw_string(dev, 10, 60, "Heart Rate", &epaper_font_20, COLORED);
+}
+
+static void draw_string_24(epaper_handle_t dev)
+{
+    iot_epaper_draw_string(dev, 10, 60, "Heart Rate", &epaper_font_24, COLORED);
+}
+
+static void draw_filled_rectangle(epaper_handle_t dev)
+{
+    iot_epaper_draw_filled_rectangle(dev, 138, 0, 177, 12, COLORED);
+}
+
+static void draw_rectangle(epaper_handle_t dev)
+{
+    iot_epaper_draw_rectangle(dev, 138, 0, 177, 12, COLORED);
+}
+
+static void draw_filled_circle(epaper_handle_t dev)
+{
+    iot_epaper_draw_filled_circle(dev, 148, 64, 40, COLORED);
+}
+
+static void draw_circle(epaper_handle_t dev)
+{
+    iot_epaper_draw_circle(dev, 148, 64, 40, COLORED);
+}
+
+static void draw_horizontal_line(epaper_handle_t dev)
+{
+    iot_epaper_draw_horizontal_line(dev, 0, 47, 296, COLORED);
+}
+
+static void draw_vertical_line(epaper_handle_t dev)
+{
+    iot_epaper_draw_vertical_line(dev, 148, 0, 128, COLORED);
+}
+
+static void draw_line(epaper_handle_t dev)
+{
+    iot_epaper_draw_line(dev, 0, 0, 295, 127, COLORED);
+}
+
+static void draw_blit(epaper_handle_t dev)
+{
+    iot_epaper_blit(dev, &icon[0][0], 35, 0, 24, 24, COLORED);
+}
+
+static void chart_add(epaper_handle_t dev)
+{
+    (void) dev;
+    chart_value = (chart_value + 37) % 200;
+    iot_epaper_chart_add(&chart, chart_value);
+}
+
+static void draw_chart(epaper_handle_t dev)
+{
+    iot_epaper_draw_chart(dev, &chart, 100, 24, COLORED);
+}
+
+static int bench_screen;
+
+// the same drawing as screen_backgrounds and update_display() do
+static void draw_screen(epaper_handle_t dev)
+{
+    iot_epaper_begin_draw(dev);
+    iot_epaper_clean_paint(dev, UNCOLORED);
+    iot_epaper_draw_rectangle(dev, 34, 0, 58, 17, COLORED);
+    iot_epaper_draw_string(dev, 35, 2, "/\\", &epaper_font_16, COLORED);
+    iot_epaper_draw_rectangle(dev, 82, 0, 122, 12, COLORED);
+    iot_epaper_draw_string(dev, 85, 1, "Wi-Fi", &epaper_font_12, COLORED);
+    iot_epaper_draw_filled_rectangle(dev, 138, 0, 177, 12, COLORED);
+    iot_epaper_draw_string(dev, 140, 1, "Cloud", &epaper_font_12, UNCOLORED);
+    iot_epaper_draw_rectangle(dev, 202, 0, 234, 12, COLORED);
+    iot_epaper_draw_string(dev, 205, 1, "RefP", &epaper_font_12, COLORED);
+    iot_epaper_draw_rectangle(dev, 262, 0, 287, 12, COLORED);
+    iot_epaper_draw_string(dev, 265, 1, "HRM", &epaper_font_12, COLORED);
+    for (int y = 20; y < 128; y += 27) {
+        iot_epaper_draw_horizontal_line(dev, 0, y, 296, COLORED);
+    }
+    for (int i = 0; i < 8; i++) {
+        const bench_text_t* t = &screen_text[bench_screen][i];
+        iot_epaper_draw_string(dev, t->x, t->y, t->text, &epaper_font_20, COLORED);
+    }
+    iot_epaper_end_draw(dev);
+}
+
+static const bench_op_t primitives[] = {
+    { "clean_paint",            draw_clean_paint },
+    { "draw_string font 8",     draw_string_8 },
+    { "draw_string font 12",    draw_string_12 },
+    { "draw_string font 16",    draw_string_16 },
+    { "draw_string font 20",    draw_string_20 },
+    { "draw_string font 24",    draw_string_24 },
+    { "draw_filled_rectangle",  draw_filled_rectangle },
+    { "draw_rectangle",         draw_rectangle },
+    { "draw_filled_circle",     draw_filled_circle },
+    { "draw_circle",            draw_circle },
+    { "draw_horizontal_line",   draw_horizontal_line },
+    { "draw_vertical_line",     draw_vertical_line },
+    { "draw_line",              draw_line },
+    { "blit 24 x 24",           draw_blit },
+    { "chart_add 192 x 48",     chart_add },
+    { "draw_chart 192 x 48",    draw_chart },
+};
+
+static int changed_bytes(epaper_handle_t dev, void (*draw)(epaper_handle_t dev))
+{
+    static uint8_t blank[BENCH_FRAME_BYTES];
+    const uint8_t* image = iot_epaper_get_image(dev);
+    int changed = 0;
+
+    iot_epaper_clean_paint(dev, UNCOLORED);
+    memcpy(blank, image, BENCH_FRAME_BYTES);
+    draw(dev);
+    for (int i = 0; i < BENCH_FRAME_BYTES; i++) {
+        changed += image[i] != blank[i];
+    }
+    return changed;
+}
+
+static void run(epaper_handle_t dev, const char* name, int rotate, void (*draw)(epaper_handle_t dev))
+{
+    long ops = 0;
+    double elapsed;
+
+    iot_epaper_set_rotate(dev, rotate);
+    if (iot_epaper_get_rotate(dev) != rotate) {
+        return;     // rotation fixed by CONFIG_EPAPER_FIXED_GEOMETRY
+    }
+    int changed = changed_bytes(dev, draw);
+    double start = now_seconds();
+    do {
+        for (int n = 0; n < 100; n++) {
+            draw(dev);
+        }
+        ops += 100;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    printf("%-24s %4d %12.0f %8d\n", name, rotate * 90, elapsed * 1e9 / ops, changed);
+}
+
+// Peak heap from creating a display to deleting it, screens 0 to 4 are displayed in between
+static long peak_heap(epaper_sim_t* sim, epaper_conf_t conf, int band_rows, bool glyph_cache)
+{
+    heap_in_use = 0;
+    heap_peak = 0;
+    conf.band_rows = band_rows;
+    epaper_handle_t dev = iot_epaper_create_with_backend(&epaper_sim_backend, sim, &conf);
+    if (dev == NULL) {
+        return -1;
+    }
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+    iot_epaper_set_glyph_cache(dev, glyph_cache);
+    for (bench_screen = 0; bench_screen < 5; bench_screen++) {
+        draw_screen(dev);
+        iot_epaper_display_frame(dev, NULL);
+    }
+    iot_epaper_delete(dev, true);
+    return heap_peak;
+}
+
+int main(void)
+{
+    epaper_conf_t conf = {
+        .busy_active_level = 1,
+        .dc_lev_data = 1,
+        .dc_lev_cmd = 0,
+        .width = EPD_WIDTH,
+        .height = EPD_HEIGHT,
+        .color_inv = 1,
+    };
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    epaper_handle_t dev = iot_epaper_create_with_backend(&epaper_sim_backend, sim, &conf);
+    if (dev == NULL) {
+        return 1;
+    }
+    for (int j = 0; j < 24; j++) {
+        for (int k = 0; k < 3; k++) {
+            icon[j][k] = (uint8_t) (j * 37 + k * 91);
+        }
+    }
+    iot_epaper_chart_init(&chart, chart_plot, 192, 48, 0, 200);
+    for (int i = 0; i < 192; i++) {
+        chart_add(dev);
+    }
+
+#ifdef CONFIG_EPAPER_FIXED_GEOMETRY
+    printf("CONFIG_EPAPER_FIXED_GEOMETRY\n");
+#endif
+    printf("%-24s %4s %12s %8s\n", "operation", "rot", "ns/op", "bytes");
+    for (size_t i = 0; i < sizeof(primitives) / sizeof(primitives[0]); i++) {
+        run(dev, primitives[i].name, E_PAPER_ROTATE_270, primitives[i].draw);
+    }
+    for (bench_screen = 0; bench_screen < 5; bench_screen++) {
+        char name[40];
+        snprintf(name, sizeof(name), "update_display screen %d", bench_screen);
+        for (int rotate = E_PAPER_ROTATE_0; rotate <= E_PAPER_ROTATE_270; rotate++) {
+            run(dev, name, rotate, draw_screen);
+        }
+    }
+
+    iot_epaper_delete(dev, true);
+
+    printf("%-24s %4s %12s %8s\n", "peak heap, screens 0-4", "rot", "cache", "bytes");
+    for (int band_rows = 0; band_rows <= BENCH_BAND_ROWS; band_rows += BENCH_BAND_ROWS) {
+        for (int glyph_cache = 0; glyph_cache <= 1; glyph_cache++) {
+            char name[40];
+            snprintf(name, sizeof(name), band_rows ? "band of %d rows" : "frame buffer", band_rows);
+            long bytes = peak_heap(sim, conf, band_rows, glyph_cache);
+            printf("%-24s %4d %12s %8ld\n", name, 270, glyph_cache ? "on" : "off", bytes);
+        }
+    }
+    epaper_sim_delete(sim);
+    return 0;
+}
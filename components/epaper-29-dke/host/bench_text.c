@@ -0,0 +1,102 @@
+// Host benchmark of text rendering of the epaper-29-dke driver.
+//
+// Draws the text of the first update_display() screen of the altimeter
+// at E_PAPER_ROTATE_270, with the glyph cache disabled (pixel by pixel
+// drawing, as before the cache was introduced) and enabled, and reports
+// characters drawn per second for both.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "epaper-29-dke.h"
+#include "epaper_fonts.h"
+#include "epaper_sim.h"
+
+#define BENCH_MIN_SECONDS   0.5
+
+typedef struct {
+    int x;
+    int y;
+    const char* text;
+    epaper_font_t* font;
+    int colored;
+} bench_string_t;
+
+static const bench_string_t screen_text[] = {
+    {  35,   2, "/\\",          &epaper_font_16, COLORED },
+    {  85,   1, "Wi-Fi",        &epaper_font_12, COLORED },
+    { 140,   1, "Cloud",        &epaper_font_12, UNCOLORED },
+    { 205,   1, "RefP",         &epaper_font_12, COLORED },
+    { 265,   1, "HRM",          &epaper_font_12, COLORED },
+    {  10,  25, "Climbed",      &epaper_font_20, COLORED },
+    {  10,  52, "Heart Rate",   &epaper_font_20, COLORED },
+    {  10,  79, "Battery",      &epaper_font_20, COLORED },
+    {  10, 106, "Up Time",      &epaper_font_20, COLORED },
+    { 155,  25, "  4504 m",     &epaper_font_20, COLORED },
+    { 155,  52, "   142 BPM",   &epaper_font_20, COLORED },
+    { 155,  79, "  3.91 V",     &epaper_font_20, COLORED },
+    { 127, 106, "10:20:05",     &epaper_font_20, COLORED },
+};
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double chars_per_second(epaper_handle_t dev)
+{
+    size_t screen_chars = 0;
+    long screens = 0;
+    double elapsed;
+
+    for (size_t i = 0; i < sizeof(screen_text) / sizeof(screen_text[0]); i++) {
+        screen_chars += strlen(screen_text[i].text);
+    }
+    double start = now_seconds();
+    do {
+        for (int n = 0; n < 100; n++) {
+            for (size_t i = 0; i < sizeof(screen_text) / sizeof(screen_text[0]); i++) {
+                const bench_string_t* s = &screen_text[i];
+                iot_epaper_draw_string(dev, s->x, s->y, s->text, s->font, s->colored);
+            }
+        }
+        screens += 100;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    return screens * screen_chars / elapsed;
+}
+
+int main(void)
+{
+    epaper_conf_t conf = {
+        .busy_active_level = 1,
+        .dc_lev_data = 1,
+        .dc_lev_cmd = 0,
+        .width = EPD_WIDTH,
+        .height = EPD_HEIGHT,
+        .color_inv = 1,
+    };
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    epaper_handle_t dev = iot_epaper_create_with_backend(&epaper_sim_backend, sim, &conf);
+    if (dev == NULL) {
+        return 1;
+    }
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+    iot_epaper_clean_paint(dev, UNCOLORED);
+
+    iot_epaper_set_glyph_cache(dev, false);
+    double before = chars_per_second(dev);
+    iot_epaper_set_glyph_cache(dev, true);
+    double after = chars_per_second(dev);
+
+    printf("update_display() screen text, E_PAPER_ROTATE_270\n");
+    printf("  pixel by pixel: %12.0f chars/s\n", before);
+    printf("  glyph cache:    %12.0f chars/s  (x%.1f)\n", after, after / before);
+
+    iot_epaper_delete(dev, true);
+    epaper_sim_delete(sim);
+    return 0;
+}
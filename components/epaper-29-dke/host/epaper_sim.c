@@ -0,0 +1,389 @@
+// Simulated DEPG0290B01 controller, see epaper_sim.h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "epaper_sim.h"
+
+#define SIM_ROW_BYTES           (EPD_WIDTH / 8)
+#define SIM_LUT_SIZE            70
+// Waveform timing in the LUT: 7 groups of 4 phase lengths and a repeat count
+#define SIM_LUT_TIMING_OFFSET   35
+#define SIM_LUT_GROUPS          7
+#define SIM_LINE_TIME_DEFAULT   62
+
+struct epaper_sim {
+    epaper_sim_conf_t conf;
+    int clk_freq_hz;
+    uint8_t ram[EPD_HEIGHT][SIM_ROW_BYTES];
+    uint8_t screen[EPD_HEIGHT][SIM_ROW_BYTES];
+    uint8_t command;
+    int param;                      /* index of next parameter byte of the command */
+    int x_start, x_end, x;          /* RAM window and address counter, in bytes */
+    int y_start, y_end, y;
+    uint8_t data_entry_mode;
+    uint8_t lut[SIM_LUT_SIZE];
+    int gate_mux;                   /* gate lines - 1 */
+    int dummy_lines;
+    uint8_t update_control;
+    bool deep_sleep;
+    uint64_t now_us;
+    uint64_t busy_until_us;
+    uint32_t dump_count;
+    epaper_idle_cb_t idle_cb;
+    void* idle_cb_arg;
+    epaper_sim_stats_t stats;
+};
+
+static int sim_clamp(int value, int max)
+{
+    return value < 0 ? 0 : value > max ? max : value;
+}
+
+/* Controller RAM content is undefined after power on / reset.
+ * It is filled with noise, so anything drawn from stale RAM shows up.
+ */
+static void sim_fill_noise(epaper_sim_t* sim)
+{
+    uint32_t seed = 0x2545F491u ^ sim->dump_count;
+    for (int y = 0; y < EPD_HEIGHT; y++) {
+        for (int x = 0; x < SIM_ROW_BYTES; x++) {
+            seed = seed * 1103515245u + 12345u;
+            sim->ram[y][x] = seed >> 24;
+        }
+    }
+}
+
+/* Register defaults, set by hardware and software reset */
+static void sim_reset_registers(epaper_sim_t* sim)
+{
+    sim->command = 0;
+    sim->param = 0;
+    sim->x_start = sim->x = 0;
+    sim->x_end = SIM_ROW_BYTES - 1;
+    sim->y_start = sim->y = 0;
+    sim->y_end = EPD_HEIGHT - 1;
+    sim->data_entry_mode = 0x03;
+    memset(sim->lut, 0, sizeof(sim->lut));
+    sim->gate_mux = EPD_HEIGHT - 1;
+    sim->dummy_lines = 0;
+    sim->update_control = 0;
+    sim->deep_sleep = false;
+}
+
+/* Number of frames the waveform in the LUT takes */
+static uint32_t sim_waveform_frames(const epaper_sim_t* sim)
+{
+    uint32_t frames = 0;
+    for (int g = 0; g < SIM_LUT_GROUPS; g++) {
+        const uint8_t* group = &sim->lut[SIM_LUT_TIMING_OFFSET + g * 5];
+        frames += (group[0] + group[1] + group[2] + group[3]) * (group[4] + 1);
+    }
+    return frames;
+}
+
+/* Save glass as binary PBM, black is 1 in PBM and 0 in controller RAM */
+static void sim_dump(epaper_sim_t* sim)
+{
+    char path[256];
+    bool swap = sim->conf.dump_rotate == E_PAPER_ROTATE_90 || sim->conf.dump_rotate == E_PAPER_ROTATE_270;
+    int width = swap ? EPD_HEIGHT : EPD_WIDTH;
+    int height = swap ? EPD_WIDTH : EPD_HEIGHT;
+    int row_bytes = (width + 7) / 8;
+
+    snprintf(path, sizeof(path), "%s%04u.pbm", sim->conf.dump_prefix, (unsigned) sim->dump_count);
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return;
+    }
+    fprintf(f, "P4\n%d %d\n", width, height);
+    uint8_t* row = calloc(1, row_bytes);
+    for (int y = 0; y < height; y++) {
+        memset(row, 0, row_bytes);
+        for (int x = 0; x < width; x++) {
+            int nx, ny;
+            switch (sim->conf.dump_rotate) {
+            case E_PAPER_ROTATE_90:
+                nx = EPD_WIDTH - 1 - y;
+                ny = x;
+                break;
+            case E_PAPER_ROTATE_180:
+                nx = EPD_WIDTH - 1 - x;
+                ny = EPD_HEIGHT - 1 - y;
+                break;
+            case E_PAPER_ROTATE_270:
+                nx = y;
+                ny = EPD_HEIGHT - 1 - x;
+                break;
+            default:
+                nx = x;
+                ny = y;
+                break;
+            }
+            if ((sim->screen[ny][nx / 8] & (0x80 >> (nx % 8))) == 0) {
+                row[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        fwrite(row, 1, row_bytes, f);
+    }
+    free(row);
+    fclose(f);
+}
+
+static void sim_master_activation(epaper_sim_t* sim)
+{
+    if ((sim->update_control & 0x04) == 0) {
+        return;     // no pattern display
+    }
+    uint32_t frames = sim_waveform_frames(sim);
+    int line_time_us = sim->conf.line_time_us ? sim->conf.line_time_us : SIM_LINE_TIME_DEFAULT;
+    uint64_t busy_us = (uint64_t) frames * (sim->gate_mux + 1 + sim->dummy_lines) * line_time_us;
+
+    memcpy(sim->screen, sim->ram, sizeof(sim->screen));
+    sim->busy_until_us = sim->now_us + busy_us;
+    sim->stats.refreshes++;
+    sim->stats.waveform_frames += frames;
+    sim->stats.busy_us += busy_us;
+    sim->stats.last_refresh_us = busy_us;
+    if (sim->conf.dump_prefix) {
+        sim_dump(sim);
+    }
+    sim->dump_count++;
+}
+
+static void sim_write_ram(epaper_sim_t* sim, uint8_t data)
+{
+    sim->ram[sim_clamp(sim->y, EPD_HEIGHT - 1)][sim_clamp(sim->x, SIM_ROW_BYTES - 1)] = data;
+    sim->stats.ram_bytes++;
+    // only X first, X and Y increment mode (0x03) is used by the driver
+    if (++sim->x > sim->x_end) {
+        sim->x = sim->x_start;
+        if (++sim->y > sim->y_end) {
+            sim->y = sim->y_start;
+        }
+    }
+}
+
+static void sim_command(epaper_sim_t* sim, uint8_t command)
+{
+    sim->command = command;
+    sim->param = 0;
+    switch (command) {
+    case E_PAPER_DEEP_SLEEP_MODE:
+        sim->deep_sleep = true;
+        break;
+    case E_PAPER_SW_RESET:
+        sim_reset_registers(sim);
+        break;
+    case E_PAPER_MASTER_ACTIVATION:
+        sim_master_activation(sim);
+        break;
+    default:
+        break;
+    }
+}
+
+static void sim_data(epaper_sim_t* sim, uint8_t data)
+{
+    int param = sim->param++;
+
+    switch (sim->command) {
+    case E_PAPER_DRIVER_OUTPUT_CONTROL:
+        if (param == 0) {
+            sim->gate_mux = (sim->gate_mux & 0x100) | data;
+        } else if (param == 1) {
+            sim->gate_mux = (data & 0x01) << 8 | (sim->gate_mux & 0xff);
+        }
+        break;
+    case 0x11:
+        sim->data_entry_mode = data;
+        if (data != 0x03) {
+            fprintf(stderr, "epaper_sim: data entry mode 0x%02x not simulated\n", data);
+        }
+        break;
+    case 0x3A:
+        sim->dummy_lines = data & 0x7f;
+        break;
+    case E_PAPER_DISPLAY_UPDATE_CONTROL_2:
+        sim->update_control = data;
+        break;
+    case E_PAPER_WRITE_RAM:
+        sim_write_ram(sim, data);
+        break;
+    case E_PAPER_WRITE_LUT_REGISTER:
+        if (param < SIM_LUT_SIZE) {
+            sim->lut[param] = data;
+        }
+        break;
+    case E_PAPER_SET_RAM_X_ADDRESS_START_END_POSITION:
+        if (param == 0) {
+            sim->x_start = data & 0x3f;
+        } else if (param == 1) {
+            sim->x_end = data & 0x3f;
+        }
+        break;
+    case E_PAPER_SET_RAM_Y_ADDRESS_START_END_POSITION:
+        if (param == 0) {
+            sim->y_start = data;
+        } else if (param == 1) {
+            sim->y_start |= (data & 0x01) << 8;
+        } else if (param == 2) {
+            sim->y_end = data;
+        } else if (param == 3) {
+            sim->y_end |= (data & 0x01) << 8;
+        }
+        break;
+    case E_PAPER_SET_RAM_X_ADDRESS_COUNTER:
+        if (param == 0) {
+            sim->x = data & 0x3f;
+        }
+        break;
+    case E_PAPER_SET_RAM_Y_ADDRESS_COUNTER:
+        if (param == 0) {
+            sim->y = data;
+        } else if (param == 1) {
+            sim->y |= (data & 0x01) << 8;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static esp_err_t sim_init(void* ctx, const epaper_conf_t* epconf, bool warm)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+    (void) warm;    // the driver resets the simulated controller when not warm
+    sim->clk_freq_hz = epconf->clk_freq_hz;
+    return ESP_OK;
+}
+
+static esp_err_t sim_deinit(void* ctx, bool del_bus)
+{
+    (void) ctx;
+    (void) del_bus;
+    return ESP_OK;
+}
+
+static void sim_reset(void* ctx)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+    sim_reset_registers(sim);
+    sim_fill_noise(sim);
+}
+
+static void sim_send(void* ctx, bool command, const uint8_t* data, int length)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+
+    sim->stats.transactions++;
+    if (sim->clk_freq_hz > 0) {
+        uint64_t us = (uint64_t) length * 8 * 1000000 / sim->clk_freq_hz;
+        sim->stats.spi_us += us;
+        epaper_sim_advance(sim, us);
+    }
+    if (sim->now_us < sim->busy_until_us) {
+        sim->stats.busy_violations += length;
+        return;     // ignored by the controller
+    }
+    if (command) {
+        sim->stats.command_bytes += length;
+    } else {
+        sim->stats.data_bytes += length;
+    }
+    if (sim->deep_sleep) {
+        return;     // only hardware reset wakes up the controller
+    }
+    for (int i = 0; i < length; i++) {
+        if (command) {
+            sim_command(sim, data[i]);
+        } else {
+            sim_data(sim, data[i]);
+        }
+    }
+}
+
+static bool sim_is_busy(void* ctx)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+    return sim->now_us < sim->busy_until_us;
+}
+
+static void sim_wait_idle(void* ctx)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+    if (sim->now_us < sim->busy_until_us) {
+        epaper_sim_advance(sim, sim->busy_until_us - sim->now_us);
+    }
+}
+
+static void sim_standby(void* ctx)
+{
+    (void) ctx;     // no pins to hold, the simulated controller keeps its state anyway
+}
+
+static void sim_set_idle_callback(void* ctx, epaper_idle_cb_t cb, void* arg)
+{
+    epaper_sim_t* sim = (epaper_sim_t*) ctx;
+    sim->idle_cb = cb;
+    sim->idle_cb_arg = arg;
+}
+
+const epaper_backend_t epaper_sim_backend = {
+    .init = sim_init,
+    .deinit = sim_deinit,
+    .reset = sim_reset,
+    .send = sim_send,
+    .wait_idle = sim_wait_idle,
+    .is_busy = sim_is_busy,
+    .sleep_until_idle = sim_wait_idle,
+    .set_idle_callback = sim_set_idle_callback,
+    .standby = sim_standby,
+};
+
+epaper_sim_t* epaper_sim_create(const epaper_sim_conf_t* conf)
+{
+    epaper_sim_t* sim = calloc(1, sizeof(epaper_sim_t));
+    if (sim == NULL) {
+        return NULL;
+    }
+    if (conf) {
+        sim->conf = *conf;
+    }
+    sim_reset_registers(sim);
+    sim_fill_noise(sim);
+    memcpy(sim->screen, sim->ram, sizeof(sim->screen));
+    return sim;
+}
+
+void epaper_sim_advance(epaper_sim_t* sim, uint64_t us)
+{
+    bool busy = sim->now_us < sim->busy_until_us;
+    sim->now_us += us;
+    if (busy && sim->now_us >= sim->busy_until_us && sim->idle_cb) {
+        sim->idle_cb(sim->idle_cb_arg);
+    }
+}
+
+void epaper_sim_delete(epaper_sim_t* sim)
+{
+    free(sim);
+}
+
+const uint8_t* epaper_sim_get_screen(const epaper_sim_t* sim)
+{
+    return &sim->screen[0][0];
+}
+
+void epaper_sim_get_stats(const epaper_sim_t* sim, epaper_sim_stats_t* stats)
+{
+    *stats = sim->stats;
+}
+
+void epaper_sim_reset_stats(epaper_sim_t* sim)
+{
+    memset(&sim->stats, 0, sizeof(sim->stats));
+}
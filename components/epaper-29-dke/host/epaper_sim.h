@@ -0,0 +1,76 @@
+// Simulated DEPG0290B01 controller, a backend of the epaper-29-dke driver
+// for host builds.
+//
+// The command stream sent by the driver is interpreted into the controller
+// RAM. On each display update the RAM is copied to the simulated glass,
+// optionally dumped as a PBM file, and the controller stays busy for
+// the duration of the waveform in the loaded LUT. Time is virtual, so
+// nothing actually waits; SPI transfer and busy time are reported in stats.
+
+#ifndef _EPAPER_SIM_H_
+#define _EPAPER_SIM_H_
+
+#include <stdint.h>
+#include "epaper-29-dke.h"
+
+typedef struct {
+    const char* dump_prefix;        /* each refresh is saved to <prefix>NNNN.pbm, NULL to disable */
+    epaper_rotate_t dump_rotate;    /* orientation of dumped images */
+    int line_time_us;               /* gate line time, 0 for 62 us (0x3B = 0x08) */
+} epaper_sim_conf_t;
+
+typedef struct {
+    uint32_t transactions;          /* backend send calls */
+    uint32_t command_bytes;
+    uint32_t data_bytes;
+    uint32_t ram_bytes;             /* bytes written to controller RAM */
+    uint32_t refreshes;
+    uint32_t waveform_frames;       /* sum over all refreshes */
+    uint32_t busy_violations;       /* bytes sent while the controller was busy */
+    uint64_t spi_us;                /* time spent on transfers at clk_freq_hz */
+    uint64_t busy_us;               /* time the controller was busy refreshing */
+    uint64_t last_refresh_us;
+} epaper_sim_stats_t;
+
+typedef struct epaper_sim epaper_sim_t;
+
+extern const epaper_backend_t epaper_sim_backend;
+
+/**
+ * @brief Create simulated controller, to be passed as context of epaper_sim_backend
+ *
+ * @param conf simulation options, NULL for defaults
+ *
+ * @return
+ *     - simulator handle
+ *     - NULL if memory cannot be allocated
+ */
+epaper_sim_t* epaper_sim_create(const epaper_sim_conf_t* conf);
+
+/**
+ * @brief Delete simulated controller, after iot_epaper_delete()
+ */
+void epaper_sim_delete(epaper_sim_t* sim);
+
+/**
+ * @brief Let virtual time pass, e.g. for work done while the display refreshes
+ *
+ * The idle callback is called if a refresh completes meanwhile.
+ */
+void epaper_sim_advance(epaper_sim_t* sim, uint64_t us);
+
+/**
+ * @brief Get image shown on the simulated glass
+ *
+ * @return EPD_HEIGHT rows of EPD_WIDTH / 8 bytes, in controller RAM layout
+ */
+const uint8_t* epaper_sim_get_screen(const epaper_sim_t* sim);
+
+/**
+ * @brief Get transfer and refresh statistics since creation or last reset of stats
+ */
+void epaper_sim_get_stats(const epaper_sim_t* sim, epaper_sim_stats_t* stats);
+
+void epaper_sim_reset_stats(epaper_sim_t* sim);
+
+#endif
@@ -0,0 +1,20 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+// Only the types used in epaper-29-dke.h, the SPI backend is not built
+// on the host.
+
+#ifndef _HOST_SPI_MASTER_H_
+#define _HOST_SPI_MASTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct spi_device_t* spi_device_handle_t;
+
+typedef enum {
+    SPI_HOST = 0,
+    HSPI_HOST = 1,
+    VSPI_HOST = 2,
+} spi_host_device_t;
+
+#endif
@@ -0,0 +1,12 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+// There is no deep sleep on the host, retained data is ordinary data.
+
+#ifndef _HOST_ESP_ATTR_H_
+#define _HOST_ESP_ATTR_H_
+
+#define RTC_DATA_ATTR
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
+
+#endif
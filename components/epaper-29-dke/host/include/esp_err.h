@@ -0,0 +1,17 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+// Only what the epaper-29-dke driver uses is provided.
+
+#ifndef _HOST_ESP_ERR_H_
+#define _HOST_ESP_ERR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+typedef int32_t esp_err_t;
+
+#define ESP_OK          0
+#define ESP_FAIL        -1
+#define ESP_ERR_NO_MEM  0x101
+
+#endif
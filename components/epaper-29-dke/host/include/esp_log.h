@@ -0,0 +1,15 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+// Logging is compiled out so it does not distort benchmark results.
+
+#ifndef _HOST_ESP_LOG_H_
+#define _HOST_ESP_LOG_H_
+
+#include "esp_err.h"
+
+#define ESP_LOGE(tag, ...)  ((void) (tag))
+#define ESP_LOGW(tag, ...)  ((void) (tag))
+#define ESP_LOGI(tag, ...)  ((void) (tag))
+#define ESP_LOGD(tag, ...)  ((void) (tag))
+#define ESP_LOGV(tag, ...)  ((void) (tag))
+
+#endif
@@ -0,0 +1,38 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+// Host benchmarks are single threaded, so critical sections are no-ops.
+
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef int portMUX_TYPE;
+
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define portMAX_DELAY                   0xffffffffUL
+#define portTICK_RATE_MS                1
+#define portTICK_PERIOD_MS              1
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void) (mux))
+#define portEXIT_CRITICAL(mux)          ((void) (mux))
+
+#define MALLOC_CAP_8BIT                 (1 << 2)
+#define MALLOC_CAP_DMA                  (1 << 3)
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void) caps;
+    return malloc(size);
+}
+
+static inline void ets_delay_us(uint32_t us)
+{
+    (void) us;
+}
+
+#endif
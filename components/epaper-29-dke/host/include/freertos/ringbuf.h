@@ -0,0 +1,8 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+
+#ifndef _HOST_RINGBUF_H_
+#define _HOST_RINGBUF_H_
+
+#include "freertos/FreeRTOS.h"
+
+#endif
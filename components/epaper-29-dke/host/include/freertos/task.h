@@ -0,0 +1,13 @@
+// Host build stand-in for the ESP-IDF header of the same name.
+
+#ifndef _HOST_TASK_H_
+#define _HOST_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    (void) ticks;
+}
+
+#endif
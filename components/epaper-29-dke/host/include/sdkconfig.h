@@ -0,0 +1 @@
+// Stand-in for the sdkconfig.h generated by menuconfig, options are passed with -D
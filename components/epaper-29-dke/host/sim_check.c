@@ -0,0 +1,454 @@
+// Check of the epaper-29-dke driver against the simulated controller.
+//
+// Shows the welcome image twice, like the badge does after power up,
+// the second time without transferring it again. Then goes through updates of the first update_display() screen of the altimeter
+// like the badge does: a full refresh of the welcome screen, partial
+// refreshes of changing values and wake ups from deep sleep, where the
+// driver is created again. Every third wake up is done without warm start,
+// so the controller is reset and its RAM is lost. Refreshes are started
+// asynchronously and other work is done meanwhile, as the badge does.
+// After each update the simulated glass is compared pixel for pixel
+// with the frame buffer.
+// Bitmaps drawn by iot_epaper_blit() in each rotation, also partly off
+// the screen, are compared with the same bitmaps drawn pixel by pixel,
+// and so are charts drawn by iot_epaper_draw_chart().
+// Last, the updates are done in band mode, each screen drawn twice in a row,
+// and the glass is compared with the same screen drawn into a frame buffer.
+// Text in bands is drawn from the glyph cache after every other wake up.
+// Then full refreshes at rising temperatures should take as long, or with
+// CONFIG_EPAPER_TEMPERATURE_WAVEFORMS, be shorter and shorter.
+// Last, with double buffering, screens are displayed faster than they
+// refresh: none should wait, and the latest screen should end up on the glass.
+// Displayed frames are saved to build/frames/ as PBM images, named with
+// the prefix given as argument.
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "epaper-29-dke.h"
+#include "epaper_fonts.h"
+#include "epaper_sim.h"
+#include "images.h"
+
+#define CHECK_UPDATES           30
+#define CHECK_WAKE_UP_EVERY     7
+#define CHECK_FRAME_BYTES       (EPD_WIDTH / 8 * EPD_HEIGHT)
+// Bitmap not a multiple of 8 pixels in either direction
+#define CHECK_BLIT_WIDTH        21
+#define CHECK_BLIT_HEIGHT       13
+// Chart with samples going out of its range
+#define CHECK_CHART_WIDTH       50
+#define CHECK_CHART_HEIGHT      21
+#define CHECK_CHART_SAMPLES     70
+// Rows of a band, the frame is not a multiple of them
+#define CHECK_BAND_ROWS         16
+// Time of other work done while the display refreshes
+#define CHECK_OTHER_WORK_US     200000
+// Time screens are looked at, longer than any refresh
+#define CHECK_LOOK_US           2000000
+
+static int idle_callbacks;
+
+static epaper_conf_t conf = {
+    .busy_active_level = 1,
+    .dc_lev_data = 1,
+    .dc_lev_cmd = 0,
+    .clk_freq_hz = 20 * 1000 * 1000,
+    .width = EPD_WIDTH,
+    .height = EPD_HEIGHT,
+    .color_inv = 1,
+};
+
+static void display_idle(void* arg)
+{
+    (void) arg;
+    idle_callbacks++;
+}
+
+static epaper_handle_t create_display(epaper_sim_t* sim, bool warm_start)
+{
+    conf.warm_start = warm_start;
+    epaper_handle_t dev = iot_epaper_create_with_backend(&epaper_sim_backend, sim, &conf);
+    if (dev) {
+        iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+        iot_epaper_set_refresh_mode(dev, E_PAPER_REFRESH_PARTIAL);
+        iot_epaper_set_full_refresh_interval(dev, 12);
+        iot_epaper_set_idle_callback(dev, display_idle, NULL);
+    }
+    return dev;
+}
+
+static int check_welcome_image(epaper_handle_t dev, epaper_sim_t* sim)
+{
+    epaper_sim_stats_t stats;
+    int failures = 0;
+
+    for (int i = 0; i < 2; i++) {
+        epaper_sim_reset_stats(sim);
+        iot_epaper_display_image(dev, &image_welcome);
+        epaper_sim_get_stats(sim, &stats);
+        bool same = memcmp(epaper_sim_get_screen(sim), image_welcome_raw, CHECK_FRAME_BYTES) == 0;
+        printf(" image  %7s  %9u  %6.1f  %7.1f%s\n", stats.refreshes ? "yes" : "-",
+                (unsigned) stats.ram_bytes, stats.spi_us / 1000.0, stats.busy_us / 1000.0,
+                same ? "" : "  glass differs from image");
+        if (!same || stats.refreshes != 1 || (i > 0 && stats.ram_bytes > 0)) {
+            failures++;
+        }
+    }
+    return failures;
+}
+
+static int check_blit(epaper_handle_t dev)
+{
+    static const int positions[][2] = {
+        { 0, 0 }, { 8, 16 }, { 13, 5 }, { -5, -3 }, { -20, 40 }, { 290, 120 }, { 120, 290 }, { 283, 1 },
+    };
+    static uint8_t blitted[CHECK_FRAME_BYTES];
+    uint8_t bitmap[CHECK_BLIT_HEIGHT][(CHECK_BLIT_WIDTH + 7) / 8];
+    int failures = 0;
+
+    for (int k = 0; k < (int) sizeof(bitmap); k++) {
+        ((uint8_t*) bitmap)[k] = (uint8_t) (k * 167 + 13);
+    }
+    for (int rotate = E_PAPER_ROTATE_0; rotate <= E_PAPER_ROTATE_270; rotate++) {
+        iot_epaper_set_rotate(dev, rotate);
+        for (int p = 0; p < (int) (sizeof(positions) / sizeof(positions[0])); p++) {
+            int x = positions[p][0];
+            int y = positions[p][1];
+            iot_epaper_clean_paint(dev, UNCOLORED);
+            iot_epaper_blit(dev, &bitmap[0][0], x, y, CHECK_BLIT_WIDTH, CHECK_BLIT_HEIGHT, COLORED);
+            memcpy(blitted, iot_epaper_get_image(dev), CHECK_FRAME_BYTES);
+            iot_epaper_clean_paint(dev, UNCOLORED);
+            for (int j = 0; j < CHECK_BLIT_HEIGHT; j++) {
+                for (int i = 0; i < CHECK_BLIT_WIDTH; i++) {
+                    if (bitmap[j][i / 8] & (0x80 >> (i % 8))) {
+                        iot_epaper_draw_pixel(dev, x + i, y + j, COLORED);
+                    }
+                }
+            }
+            if (memcmp(blitted, iot_epaper_get_image(dev), CHECK_FRAME_BYTES) != 0) {
+                printf(" blit at (%d, %d) rotated %d differs from pixels\n", x, y, rotate);
+                failures++;
+            }
+        }
+    }
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+    return failures;
+}
+
+static int check_chart(epaper_handle_t dev)
+{
+    static const int positions[][2] = { { 0, 0 }, { 100, 24 }, { 13, 78 }, { 250, 110 } };
+    static uint8_t charted[CHECK_FRAME_BYTES];
+    static uint8_t plot[EPAPER_CHART_PLOT_SIZE(CHECK_CHART_WIDTH, CHECK_CHART_HEIGHT)];
+    epaper_chart_t chart;
+    int failures = 0;
+
+    iot_epaper_chart_init(&chart, plot, CHECK_CHART_WIDTH, CHECK_CHART_HEIGHT, 100, 200);
+    for (int s = 0; s < CHECK_CHART_SAMPLES; s++) {
+        iot_epaper_chart_add(&chart, 150 + (s * 37) % 130 - 65);
+    }
+    for (int rotate = E_PAPER_ROTATE_0; rotate <= E_PAPER_ROTATE_270; rotate++) {
+        iot_epaper_set_rotate(dev, rotate);
+        for (int p = 0; p < (int) (sizeof(positions) / sizeof(positions[0])); p++) {
+            int x = positions[p][0];
+            int y = positions[p][1];
+            iot_epaper_clean_paint(dev, COLORED);
+            iot_epaper_draw_chart(dev, &chart, x, y, COLORED);
+            memcpy(charted, iot_epaper_get_image(dev), CHECK_FRAME_BYTES);
+            iot_epaper_clean_paint(dev, COLORED);
+            iot_epaper_draw_filled_rectangle(dev, x, y, x + CHECK_CHART_WIDTH - 1, y + CHECK_CHART_HEIGHT - 1,
+                    UNCOLORED);
+            for (int i = 0; i < CHECK_CHART_WIDTH; i++) {
+                for (int j = 0; j < CHECK_CHART_HEIGHT; j++) {
+                    if (plot[i * EPAPER_CHART_COLUMN_BYTES(CHECK_CHART_HEIGHT) + j / 8] & (0x80 >> (j % 8))) {
+                        iot_epaper_draw_pixel(dev, x + i, y + j, COLORED);
+                    }
+                }
+            }
+            if (memcmp(charted, iot_epaper_get_image(dev), CHECK_FRAME_BYTES) != 0) {
+                printf(" chart at (%d, %d) rotated %d differs from pixels\n", x, y, rotate);
+                failures++;
+            }
+        }
+    }
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+    return failures;
+}
+
+static void draw_screen(epaper_handle_t dev, int update)
+{
+    char text[16];
+
+    iot_epaper_clean_paint(dev, UNCOLORED);
+    iot_epaper_draw_string(dev, 35, 2, "/\\", &epaper_font_16, COLORED);
+    iot_epaper_draw_string(dev, 85, 1, "Wi-Fi", &epaper_font_12, COLORED);
+    if (update % 5 == 0) {
+        iot_epaper_draw_filled_rectangle(dev, 138, 0, 180, 14, COLORED);
+        iot_epaper_draw_string(dev, 140, 1, "Cloud", &epaper_font_12, UNCOLORED);
+    }
+    iot_epaper_draw_horizontal_line(dev, 0, 20, 296, COLORED);
+    iot_epaper_draw_string(dev, 10, 25, "Climbed", &epaper_font_20, COLORED);
+    iot_epaper_draw_string(dev, 10, 52, "Heart Rate", &epaper_font_20, COLORED);
+    iot_epaper_draw_string(dev, 10, 79, "Battery", &epaper_font_20, COLORED);
+    iot_epaper_draw_string(dev, 10, 106, "Up Time", &epaper_font_20, COLORED);
+    sprintf(text, "%6d m", 4500 + update / 3);
+    iot_epaper_draw_string(dev, 155, 25, text, &epaper_font_20, COLORED);
+    sprintf(text, "%6d BPM", 130 + update % 20);
+    iot_epaper_draw_string(dev, 155, 52, text, &epaper_font_20, COLORED);
+    iot_epaper_draw_string(dev, 155, 79, "  3.91 V", &epaper_font_20, COLORED);
+    sprintf(text, "10:20:%02d", (update * 5 / 2) % 60);
+    iot_epaper_draw_string(dev, 127, 106, text, &epaper_font_20, COLORED);
+}
+
+// draw_screen() with a chart and a blit, or text on an image, so every drawing function is recorded
+static void draw_band_screen(epaper_handle_t dev, int screen, const epaper_chart_t* chart, const uint8_t* bitmap)
+{
+    if (screen % 4 == 3) {
+        iot_epaper_load_paint(dev, image_welcome_raw);
+        iot_epaper_draw_char(dev, 5 + screen, 110, 'A', &epaper_font_16, COLORED);
+        return;
+    }
+    draw_screen(dev, screen);
+    iot_epaper_draw_vertical_line(dev, 290, 30, 90, COLORED);
+    iot_epaper_draw_rectangle(dev, 200, 60, 230, 75, COLORED);
+    iot_epaper_draw_circle(dev, 260, 90, 12, COLORED);
+    iot_epaper_draw_filled_circle(dev, 260, 90, 5 + screen % 5, COLORED);
+    iot_epaper_draw_line(dev, 0, 127, 120 + screen, 30, COLORED);
+    iot_epaper_draw_pixel(dev, 295, 0, COLORED);
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_90);
+    iot_epaper_draw_chart(dev, chart, 40 + screen, 20, COLORED);
+    iot_epaper_blit(dev, bitmap, 250 - screen, 100, CHECK_BLIT_WIDTH, CHECK_BLIT_HEIGHT, COLORED);
+    iot_epaper_set_rotate(dev, E_PAPER_ROTATE_270);
+}
+
+static int check_bands(void)
+{
+    static uint8_t plot[EPAPER_CHART_PLOT_SIZE(CHECK_CHART_WIDTH, CHECK_CHART_HEIGHT)];
+    static uint8_t previous[CHECK_FRAME_BYTES];
+    uint8_t bitmap[CHECK_BLIT_HEIGHT][(CHECK_BLIT_WIDTH + 7) / 8];
+    epaper_chart_t chart;
+    epaper_sim_stats_t stats;
+    int failures = 0;
+
+    for (int k = 0; k < (int) sizeof(bitmap); k++) {
+        ((uint8_t*) bitmap)[k] = (uint8_t) (k * 59 + 7);
+    }
+    iot_epaper_chart_init(&chart, plot, CHECK_CHART_WIDTH, CHECK_CHART_HEIGHT, 0, 100);
+    // the same screens drawn into the frame buffer of a display that is never refreshed
+    epaper_sim_t* frame_sim = epaper_sim_create(NULL);
+    epaper_handle_t frame_dev = create_display(frame_sim, false);
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    conf.band_rows = CHECK_BAND_ROWS;
+    epaper_handle_t dev = create_display(sim, false);
+    if (frame_dev == NULL || dev == NULL || iot_epaper_get_image(dev) != NULL) {
+        return 1;
+    }
+    // the glass of the new simulator does not show the frame displayed last
+    iot_epaper_invalidate_frame(dev);
+
+    printf("band    refresh  RAM bytes  SPI ms  busy ms\n");
+    for (int update = 0; update < CHECK_UPDATES; update++) {
+        int screen = update / 2;
+        if (update > 0 && update % CHECK_WAKE_UP_EVERY == 0) {
+            iot_epaper_delete(dev, true);
+            dev = create_display(sim, true);
+            // off by default in band mode
+            iot_epaper_set_glyph_cache(dev, update / CHECK_WAKE_UP_EVERY % 2 == 1);
+        }
+        if (update % 2 == 0) {
+            iot_epaper_chart_add(&chart, screen * 41 % 100);
+        }
+        draw_band_screen(frame_dev, screen, &chart, &bitmap[0][0]);
+        draw_band_screen(dev, screen, &chart, &bitmap[0][0]);
+        epaper_sim_reset_stats(sim);
+        iot_epaper_display_frame(dev, NULL);
+        epaper_sim_get_stats(sim, &stats);
+
+        const uint8_t* frame = iot_epaper_get_image(frame_dev);
+        bool same = memcmp(epaper_sim_get_screen(sim), frame, CHECK_FRAME_BYTES) == 0;
+        bool changed = update == 0 || memcmp(previous, frame, CHECK_FRAME_BYTES) != 0;
+        memcpy(previous, frame, CHECK_FRAME_BYTES);
+        printf("%6d  %7s  %9u  %6.1f  %7.1f%s%s\n", update, stats.refreshes ? "yes" : "-",
+                (unsigned) stats.ram_bytes, stats.spi_us / 1000.0, stats.busy_us / 1000.0,
+                same ? "" : "  glass differs from frame buffer",
+                changed == (stats.refreshes > 0) ? "" : "  refresh not as expected");
+        if (!same || changed != (stats.refreshes > 0) || stats.busy_violations) {
+            failures++;
+        }
+    }
+    conf.band_rows = 0;
+    iot_epaper_delete(dev, true);
+    iot_epaper_delete(frame_dev, true);
+    epaper_sim_delete(sim);
+    epaper_sim_delete(frame_sim);
+    return failures;
+}
+
+static int check_temperature(void)
+{
+    static const int temperatures[] = { -10, 5, 14, 15, 25 };
+    epaper_sim_stats_t stats;
+    uint64_t previous_us = 0;
+    uint64_t cold_us = 0;
+    int failures = 0;
+
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    epaper_handle_t dev = create_display(sim, false);
+    if (dev == NULL) {
+        return 1;
+    }
+    iot_epaper_set_refresh_mode(dev, E_PAPER_REFRESH_FULL);
+    printf("temperature  busy ms\n");
+    for (int i = 0; i < (int) (sizeof(temperatures) / sizeof(temperatures[0])); i++) {
+        iot_epaper_set_temperature(dev, temperatures[i]);
+        draw_screen(dev, i);
+        epaper_sim_reset_stats(sim);
+        iot_epaper_display_frame(dev, NULL);
+        epaper_sim_get_stats(sim, &stats);
+        bool same = memcmp(epaper_sim_get_screen(sim), iot_epaper_get_image(dev), CHECK_FRAME_BYTES) == 0;
+        printf("%11d  %7.1f%s\n", temperatures[i], stats.busy_us / 1000.0,
+                same ? "" : "  glass differs from frame buffer");
+#ifdef CONFIG_EPAPER_TEMPERATURE_WAVEFORMS
+        // as long as at the temperature before, or shorter
+        bool longer = i > 0 && stats.last_refresh_us > previous_us;
+#else
+        // the vendor waveform at any temperature
+        bool longer = i > 0 && stats.last_refresh_us != previous_us;
+#endif
+        if (!same || stats.refreshes != 1 || longer) {
+            failures++;
+        }
+        previous_us = stats.last_refresh_us;
+        if (i == 0) {
+            cold_us = previous_us;
+        }
+    }
+#ifdef CONFIG_EPAPER_TEMPERATURE_WAVEFORMS
+    if (previous_us >= cold_us) {
+        printf(" full refresh at room temperature is not shorter than cold\n");
+        failures++;
+    }
+#else
+    (void) cold_us;
+#endif
+    iot_epaper_delete(dev, true);
+    epaper_sim_delete(sim);
+    return failures;
+}
+
+static int check_double_buffer(void)
+{
+    static uint8_t displayed[CHECK_FRAME_BYTES];
+    epaper_sim_stats_t stats;
+    int failures = 0;
+
+    epaper_sim_t* sim = epaper_sim_create(NULL);
+    conf.double_buffer = true;
+    epaper_handle_t dev = create_display(sim, false);
+    conf.double_buffer = false;
+    if (dev == NULL) {
+        return 1;
+    }
+    iot_epaper_invalidate_frame(dev);
+    printf("double  refresh  RAM bytes  SPI ms  busy ms\n");
+    for (int update = 0; update < CHECK_UPDATES; update++) {
+        epaper_sim_reset_stats(sim);
+        draw_screen(dev, update);
+        iot_epaper_display_frame_async(dev, NULL);
+        memcpy(displayed, iot_epaper_get_image(dev), CHECK_FRAME_BYTES);
+        epaper_sim_get_stats(sim, &stats);
+        // sent right away only if the refresh before is complete and was not followed by a queued frame
+        bool idle_before = update == 0 || (update % 4 == 0 && update % 8 != 4);
+        bool same = true;
+        if (update % 4 == 3) {
+            // the next screen is drawn meanwhile
+            draw_screen(dev, update + 1);
+            epaper_sim_advance(sim, CHECK_LOOK_US);
+            if (update % 8 == 3) {
+                // finds the controller idle and sends the queued frame
+                bool busy = iot_epaper_is_busy(dev);
+                epaper_sim_get_stats(sim, &stats);
+                same = memcmp(epaper_sim_get_screen(sim), displayed, CHECK_FRAME_BYTES) == 0;
+                if (!busy || stats.refreshes != 1) {
+                    printf("%6d  queued frame not sent by iot_epaper_is_busy()\n", update);
+                    failures++;
+                }
+            }
+        }
+        printf("%6d  %7s  %9u  %6.1f  %7.1f%s\n", update, stats.refreshes ? "yes" : "-",
+                (unsigned) stats.ram_bytes, stats.spi_us / 1000.0, stats.busy_us / 1000.0,
+                same ? "" : "  glass differs from frame buffer");
+        if (!same || stats.busy_violations || (update % 8 != 3 && (stats.refreshes > 0) != idle_before)) {
+            failures++;
+        }
+    }
+    // the last screen is queued, and displayed by waiting
+    iot_epaper_wait_idle(dev);
+    if (memcmp(epaper_sim_get_screen(sim), displayed, CHECK_FRAME_BYTES) != 0) {
+        printf(" last queued frame not displayed\n");
+        failures++;
+    }
+    iot_epaper_delete(dev, true);
+    epaper_sim_delete(sim);
+    return failures;
+}
+
+int main(int argc, char* argv[])
+{
+    epaper_sim_conf_t sim_conf = {
+        .dump_prefix = argc > 1 ? argv[1] : "build/frames/screen_",
+        .dump_rotate = E_PAPER_ROTATE_270,
+    };
+    epaper_sim_stats_t stats;
+    int failures = 0;
+
+    mkdir("build/frames", 0755);
+    epaper_sim_t* sim = epaper_sim_create(&sim_conf);
+    epaper_handle_t dev = create_display(sim, true);
+    if (sim == NULL || dev == NULL) {
+        return 1;
+    }
+
+    failures += check_blit(dev);
+    failures += check_chart(dev);
+    printf("update  refresh  RAM bytes  SPI ms  busy ms\n");
+    failures += check_welcome_image(dev, sim);
+    for (int update = 0; update < CHECK_UPDATES; update++) {
+        if (update > 0 && update % CHECK_WAKE_UP_EVERY == 0) {
+            // deep sleep and wake up, the display is put into deep sleep too
+            iot_epaper_delete(dev, true);
+            dev = create_display(sim, update / CHECK_WAKE_UP_EVERY % 3 != 0);
+        }
+        epaper_sim_reset_stats(sim);
+        idle_callbacks = 0;
+        draw_screen(dev, update);
+        iot_epaper_display_frame_async(dev, NULL);
+        bool busy = iot_epaper_is_busy(dev);
+        epaper_sim_advance(sim, CHECK_OTHER_WORK_US);
+        iot_epaper_wait_idle(dev);
+        epaper_sim_get_stats(sim, &stats);
+        if (busy != (stats.refreshes > 0) || idle_callbacks != (int) stats.refreshes) {
+            printf("%6d  busy %d, %d idle callbacks for %u refreshes\n", update, busy,
+                    idle_callbacks, (unsigned) stats.refreshes);
+            failures++;
+        }
+
+        bool same = memcmp(epaper_sim_get_screen(sim), iot_epaper_get_image(dev), CHECK_FRAME_BYTES) == 0;
+        printf("%6d  %7s  %9u  %6.1f  %7.1f%s\n", update, stats.refreshes ? "yes" : "-",
+                (unsigned) stats.ram_bytes, stats.spi_us / 1000.0, stats.busy_us / 1000.0,
+                same ? "" : "  glass differs from frame buffer");
+        if (!same || stats.busy_violations) {
+            failures++;
+        }
+    }
+    iot_epaper_delete(dev, true);
+    epaper_sim_delete(sim);
+    failures += check_bands();
+    failures += check_temperature();
+    failures += check_double_buffer();
+
+    printf("%s\n", failures ? "FAIL" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,282 @@
+#!/usr/bin/env python
+#
+# Generate font tables of the epaper-29-dke driver with only the glyphs
+# the firmware draws, for CONFIG_EPAPER_FONT_SUBSET.
+#
+# C sources are scanned for iot_epaper_draw_string() and iot_epaper_draw_char()
+# calls with &epaper_font_NN. Characters of literal strings are kept, and for
+# a text buffer the characters it may be given by sprintf() format strings
+# and strcpy() literals since it was last drawn. Elements of an array of buffers
+# count as one buffer. Text that cannot be resolved keeps the whole font.
+# A font not given literally, e.g. from a table of fields, may be any font
+# whose address is taken in the file other than in draw calls. Kept glyphs are stored bit packed,
+# without padding of rows. With --strict, text that keeps the whole font is an error.
+#
+# Usage: epaper_font_subset.py [--chars " -"] [--strict] -o epaper_font_subset.h epaper_font.c sources.c ...
+#
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import sys
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+ALL_CHARS = set(chr(c) for c in range(FIRST_CHAR, LAST_CHAR + 1))
+
+# characters printed by sprintf() conversions
+CONVERSION_CHARS = {
+    'd': '0123456789-',
+    'i': '0123456789-',
+    'u': '0123456789',
+    'f': '0123456789.-',
+    'x': '0123456789abcdef',
+    'X': '0123456789ABCDEF',
+    '%': '%',
+}
+
+DRAW_FUNCTIONS = ('iot_epaper_draw_string', 'iot_epaper_draw_char')
+
+STRING_RE = r'"(?:[^"\\]|\\.)*"'
+CHAR_RE = r"'(?:[^'\\]|\\.)'"
+
+
+def read_fonts(path):
+    """Returns {size: (width, height, glyph rows)} of the full font tables"""
+    with open(path) as f:
+        source = f.read()
+    tables = {}
+    for match in re.finditer(r'Font(\d+)_Table\[\]\s*=\s*\{(.*?)\};', source, re.S):
+        body = re.sub(r'//[^\n]*', '', match.group(2))
+        tables[match.group(1)] = bytearray(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', body))
+    fonts = {}
+    for match in re.finditer(r'epaper_font_t\s+epaper_font_(\d+)\s*=\s*\{\s*(\d+),[^\n]*\n\s*(\d+),', source):
+        size, width, height = match.group(1), int(match.group(2)), int(match.group(3))
+        table = tables[size]
+        row_bytes = (width + 7) // 8
+        glyph_bytes = row_bytes * height
+        if len(table) != glyph_bytes * len(ALL_CHARS):
+            raise ValueError('Font%s_Table: %d bytes, expected %d' % (size, len(table), glyph_bytes * len(ALL_CHARS)))
+        glyphs = []
+        for index in range(len(ALL_CHARS)):
+            glyph = table[index * glyph_bytes:(index + 1) * glyph_bytes]
+            glyphs.append([[(glyph[j * row_bytes + i // 8] >> (7 - i % 8)) & 1 for i in range(width)]
+                           for j in range(height)])
+        fonts[size] = (width, height, glyphs)
+    return fonts
+
+
+def unescape(literal):
+    """Returns characters of a C string or character literal, without quotes"""
+    text = literal[1:-1]
+    escapes = {'n': '\n', 't': '\t', 'r': '\r', '0': '\0'}
+    return re.sub(r'\\(.)', lambda m: escapes.get(m.group(1), m.group(1)), text)
+
+
+def split_args(text, start):
+    """Returns arguments of a call, 'start' is the index after its '('"""
+    args = []
+    depth = 0
+    arg_start = start
+    i = start
+    while i < len(text):
+        c = text[i]
+        if c in '"\'':
+            match = re.compile(STRING_RE if c == '"' else CHAR_RE).match(text, i)
+            i = match.end() if match else i + 1
+            continue
+        if c in '([{':
+            depth += 1
+        elif c in ')]}':
+            if depth == 0:
+                args.append(text[arg_start:i].strip())
+                return args
+            depth -= 1
+        elif c == ',' and depth == 0:
+            args.append(text[arg_start:i].strip())
+            arg_start = i + 1
+        i += 1
+    raise ValueError('unterminated call')
+
+
+def calls(source, names):
+    """Yields position, function name and arguments of calls in order"""
+    for match in re.finditer(r'(?:\b(\w+)\s+)?\b(%s)\s*\(' % '|'.join(names), source):
+        if match.group(1) not in (None, 'return', 'else'):
+            continue    # definition or declaration, after its return type
+        yield match.start(2), match.group(2), split_args(source, match.end())
+
+
+def format_chars(fmt, args):
+    """Returns characters sprintf() may print for the format, None if unknown"""
+    chars = set()
+    pos = 0
+    for match in re.finditer(r'%[-+ #0]*(\*|\d+)?(\.\d+)?(hh|h|ll|l|z)?([a-zA-Z%])', fmt):
+        chars |= set(fmt[pos:match.start()])
+        pos = match.end()
+        conversion = match.group(4)
+        if conversion != '%':
+            arg = args.pop(0) if args else ''
+        if match.group(1) or (match.group(2) and conversion != 'f'):
+            chars.add(' ')  # padding
+        if conversion == 's':
+            literals = re.findall(STRING_RE, arg)
+            if not literals or re.sub(STRING_RE, '', arg).count('?') != len(literals) - 1:
+                return None
+            for literal in literals:
+                chars |= set(unescape(literal))
+        elif conversion in CONVERSION_CHARS:
+            chars |= set(CONVERSION_CHARS[conversion])
+        else:
+            return None
+    return chars | set(fmt[pos:])
+
+
+def buffer_name(arg):
+    """Returns the text buffer of an argument, without subscripts"""
+    return re.sub(r'\s*\[[^\]]*\]', '', arg)
+
+
+def written_chars(function, args):
+    """Returns characters a call writes to its first argument, None if unknown"""
+    if function == 'snprintf':
+        args = args[:1] + args[2:]
+    if len(args) < 2 or not re.match(STRING_RE + '$', args[1]):
+        return None
+    if function in ('sprintf', 'snprintf'):
+        return format_chars(unescape(args[1]), args[2:])
+    return set(unescape(args[1]))
+
+
+def used_chars(path, fonts):
+    """Adds characters drawn by the source file to 'fonts' {size: set}
+    Returns the number of draw calls that keep the whole font."""
+    with open(path) as f:
+        source = f.read()
+    # comments are blanked, keeping line numbers and strings containing '//'
+    source = re.sub(STRING_RE + '|' + CHAR_RE + r'|/\*.*?\*/|//[^\n]*',
+                    lambda m: m.group(0) if m.group(0)[0] in '"\'' else '\n' * m.group(0).count('\n'),
+                    source, flags=re.S)
+    # fonts a font pointer may point to, with the address taken not just for a draw call
+    references = re.findall(r'&\s*epaper_font_(\d+)\b', source)
+    for _, _, args in calls(source, DRAW_FUNCTIONS):
+        match = re.match(r'&\s*epaper_font_(\d+)$', args[4]) if len(args) >= 6 else None
+        if match:
+            references.remove(match.group(1))
+    referenced = sorted(set(references) & set(fonts), key=int)
+    # characters written to each buffer since it was last drawn, and drawn last time
+    written = {}
+    drawn = {}
+    unresolved = 0
+    for pos, function, args in calls(source, DRAW_FUNCTIONS + ('sprintf', 'snprintf', 'strcpy', 'strcat')):
+        if not function.startswith('iot_epaper'):
+            if args:
+                chars = written_chars(function, args)
+                name = buffer_name(args[0])
+                previous = written.get(name, set())
+                if chars is None or previous is None:
+                    written[name] = None
+                else:
+                    written[name] = previous | chars
+            continue
+        if len(args) < 6:
+            continue
+        text, font = args[3], args[4]
+        match = re.match(r'&\s*epaper_font_(\d+)$', font)
+        sizes = [match.group(1)] if match else referenced or list(fonts)
+        name = buffer_name(text)
+        if re.match(STRING_RE + '$', text) or re.match(CHAR_RE + '$', text):
+            chars = set(unescape(text))
+        elif name in written:
+            chars = written.pop(name)
+            drawn[name] = chars
+        else:
+            chars = drawn.get(name)
+        if chars is None:
+            line = source.count('\n', 0, pos) + 1
+            print('%s:%d: %s(%s, %s) keeps whole font' % (os.path.basename(path), line, function, text, font),
+                  file=sys.stderr)
+            chars = ALL_CHARS
+            unresolved += 1
+        for size in sizes:
+            fonts[size] |= chars & ALL_CHARS
+    return unresolved
+
+
+def pack_glyph(rows):
+    bits = [bit for row in rows for bit in row]
+    bits += [0] * (-len(bits) % 8)
+    return bytearray(sum(bit << (7 - k) for k, bit in enumerate(bits[i:i + 8])) for i in range(0, len(bits), 8))
+
+
+def c_array(name, data):
+    lines = ['static const uint8_t %s[%d] = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate font tables with glyphs used by the firmware')
+    parser.add_argument('-o', '--output', required=True, help='generated C header')
+    parser.add_argument('--chars', default='', help='characters kept in all fonts')
+    parser.add_argument('--strict', action='store_true', help='fail if any draw call keeps the whole font')
+    parser.add_argument('font_source', help='epaper_font.c with the full font tables')
+    parser.add_argument('sources', nargs='*', help='C sources of the firmware')
+    args = parser.parse_args()
+
+    fonts = read_fonts(args.font_source)
+    used = dict((size, set(args.chars) & ALL_CHARS) for size in fonts)
+    unresolved = 0
+    for path in args.sources:
+        unresolved += used_chars(path, used)
+    if args.strict and unresolved:
+        print('%d draw calls keep whole fonts' % unresolved, file=sys.stderr)
+        return 1
+
+    guard = re.sub(r'\W', '_', os.path.basename(args.output)).upper()
+    out = ['// Generated by epaper_font_subset.py, do not edit',
+           '',
+           '#ifndef _%s_' % guard,
+           '#define _%s_' % guard,
+           '']
+    total = full = 0
+    for size in sorted(fonts, key=int):
+        width, height, glyphs = fonts[size]
+        glyph_map = bytearray(len(ALL_CHARS))
+        table = bytearray()
+        count = 0
+        for index in range(len(ALL_CHARS)):
+            if chr(FIRST_CHAR + index) in used[size]:
+                count += 1
+                glyph_map[index] = count
+                table += pack_glyph(glyphs[index])
+        full_bytes = (width + 7) // 8 * height * len(ALL_CHARS)
+        total += len(table) + len(glyph_map)
+        full += full_bytes
+        out.append('// epaper_font_%s: %d of %d glyphs, %d bytes instead of %d'
+                   % (size, count, len(ALL_CHARS), len(table) + len(glyph_map), full_bytes))
+        # quoted, a trailing backslash would continue the comment
+        out.append('// "%s"' % ''.join(sorted(used[size])).replace('\\', '\\\\').replace('"', '\\"'))
+        out.append(c_array('font%s_glyph_map' % size, glyph_map))
+        out.append(c_array('font%s_glyphs' % size, table or bytearray(1)))
+        out.append('epaper_font_t epaper_font_%s = {' % size)
+        out.append('    .width = %d,' % width)
+        out.append('    .height = %d,' % height)
+        out.append('    .font_table = font%s_glyphs,' % size)
+        out.append('    .glyph_map = font%s_glyph_map,' % size)
+        out.append('    .packed = true,')
+        out.append('};')
+        out.append('')
+    out.append('#endif')
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print('%s: %d bytes of fonts instead of %d' % (os.path.basename(args.output), total, full))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
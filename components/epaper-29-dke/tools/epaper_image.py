@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+#
+# Convert PBM images into PackBits compressed epaper_image_t C definitions
+# for iot_epaper_display_image() of the epaper-29-dke driver.
+#
+# Images are drawn as seen on the screen, e.g. 296 x 128 for the badge,
+# and rotated into controller RAM layout (128 x 296) with --rotate,
+# the same way as the driver's E_PAPER_ROTATE_* modes.
+#
+# Usage: epaper_image.py [--rotate 270] [--raw] -o images.h welcome.pbm ...
+#
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import sys
+
+EPD_WIDTH = 128
+EPD_HEIGHT = 296
+
+
+def read_pbm(path):
+    """Returns width, height and rows of pixels, 1 is black"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    # magic, width and height, separated by whitespace and comments
+    while len(tokens) < 3:
+        match = re.compile(br'\s*(#[^\n]*\n\s*)*(\S+)').match(data, pos)
+        if match is None:
+            raise ValueError('%s: truncated header' % path)
+        tokens.append(match.group(2))
+        pos = match.end()
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if magic == b'P4':
+        pos += 1    # single whitespace before raster
+        row_bytes = (width + 7) // 8
+        raster = bytearray(data[pos:pos + row_bytes * height])
+        if len(raster) != row_bytes * height:
+            raise ValueError('%s: truncated raster' % path)
+        return width, height, [[(raster[y * row_bytes + x // 8] >> (7 - x % 8)) & 1
+                                for x in range(width)] for y in range(height)]
+    if magic == b'P1':
+        bits = [int(c) for c in re.sub(br'#[^\n]*|\s', b'', data[pos:]).decode()]
+        if len(bits) < width * height:
+            raise ValueError('%s: truncated raster' % path)
+        return width, height, [bits[y * width:(y + 1) * width] for y in range(height)]
+    raise ValueError('%s: not a PBM image' % path)
+
+
+def to_ram(width, height, pixels, rotate):
+    """Returns controller RAM bytes of the image, 0 bits are black"""
+    if rotate in (90, 270):
+        ram_width, ram_height = height, width
+    else:
+        ram_width, ram_height = width, height
+    if ram_width != EPD_WIDTH or ram_height != EPD_HEIGHT:
+        raise ValueError('image is %d x %d, rotated by %d it should be %d x %d'
+                         % (width, height, rotate, EPD_WIDTH, EPD_HEIGHT))
+    ram = bytearray([0xFF] * (EPD_WIDTH // 8 * EPD_HEIGHT))
+    for ny in range(EPD_HEIGHT):
+        for nx in range(EPD_WIDTH):
+            if rotate == 90:
+                x, y = ny, EPD_WIDTH - 1 - nx
+            elif rotate == 180:
+                x, y = EPD_WIDTH - 1 - nx, EPD_HEIGHT - 1 - ny
+            elif rotate == 270:
+                x, y = EPD_HEIGHT - 1 - ny, nx
+            else:
+                x, y = nx, ny
+            if pixels[y][x]:
+                ram[ny * EPD_WIDTH // 8 + nx // 8] &= ~(0x80 >> (nx % 8)) & 0xFF
+    return ram
+
+
+def packbits(data):
+    """PackBits: header n >= 0 copies n + 1 bytes, n < 0 repeats next byte 1 - n times"""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3 or (run == 2 and not literal):
+            if literal:
+                out.append(len(literal) - 1)
+                out += literal
+                literal = bytearray()
+            out.append((1 - run) & 0xFF)
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+            if len(literal) == 128:
+                out.append(127)
+                out += literal
+                literal = bytearray()
+    if literal:
+        out.append(len(literal) - 1)
+        out += literal
+    return out
+
+
+def unpackbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        header = data[i] - 256 if data[i] > 127 else data[i]
+        i += 1
+        if header >= 0:
+            out += data[i:i + header + 1]
+            i += header + 1
+        elif header != -128:
+            out += bytearray([data[i]]) * (1 - header)
+            i += 1
+    return out
+
+
+def c_array(name, data):
+    lines = ['static const uint8_t %s[%d] = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert PBM images into epaper_image_t definitions')
+    parser.add_argument('-o', '--output', required=True, help='generated C header')
+    parser.add_argument('-r', '--rotate', type=int, default=0, choices=(0, 90, 180, 270),
+                        help='rotation of images relative to controller RAM')
+    parser.add_argument('--raw', action='store_true', help='also define uncompressed RAM bytes')
+    parser.add_argument('images', nargs='+', help='PBM images')
+    args = parser.parse_args()
+
+    guard = re.sub(r'\W', '_', os.path.basename(args.output)).upper()
+    out = ['// Generated by epaper_image.py, do not edit',
+           '',
+           '#ifndef _%s_' % guard,
+           '#define _%s_' % guard,
+           '',
+           '#include "epaper-29-dke.h"',
+           '']
+    for path in args.images:
+        name = 'image_' + re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0])
+        ram = to_ram(*read_pbm(path), rotate=args.rotate)
+        packed = packbits(ram)
+        assert unpackbits(packed) == ram
+        out.append('// %s, %d bytes packed to %d' % (os.path.basename(path), len(ram), len(packed)))
+        out.append(c_array(name + '_data', packed))
+        out.append('static const epaper_image_t %s = {' % name)
+        out.append('    .width = %d,' % EPD_WIDTH)
+        out.append('    .height = %d,' % EPD_HEIGHT)
+        out.append('    .size = sizeof(%s_data),' % name)
+        out.append('    .data = %s_data,' % name)
+        out.append('};')
+        if args.raw:
+            out.append(c_array(name + '_raw', ram))
+        out.append('')
+    out.append('#endif')
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -31,6 +31,7 @@ static const char* TAG = "Wi-Fi";
 #define EXAMPLE_WIFI_SSID CONFIG_WIFI_SSID
 #define EXAMPLE_WIFI_PASS CONFIG_WIFI_PASSWORD
 
+static bool wifi_start_done = false;
 static bool wifi_init_done = false;
 
 /* FreeRTOS event group to signal when we are connected & ready to make a request */
@@ -70,10 +71,17 @@ static esp_err_t event_handler(void *ctx, system_event_t *event)
     return ESP_OK;
 }
 
-esp_err_t wifi_initialize(void)
+/**
+@brief Turn Wi-Fi on and start connecting to the access point, without waiting
+for the connection, so other work is done meanwhile, see wifi_initialize()
+
+@return
+    - ESP_OK - Wi-Fi has been started
+*/
+esp_err_t wifi_start(void)
 {
 
-    if (wifi_init_done) {
+    if (wifi_start_done) {
         return ESP_OK;
     }
 
@@ -98,6 +106,18 @@ esp_err_t wifi_initialize(void)
     ESP_ERROR_CHECK( esp_wifi_set_config(ESP_IF_WIFI_STA, &wifi_config) );
     ESP_ERROR_CHECK( esp_wifi_start() );
 
+    wifi_start_done = true;
+    return ESP_OK;
+}
+
+esp_err_t wifi_initialize(void)
+{
+
+    if (wifi_init_done) {
+        return ESP_OK;
+    }
+
+    wifi_start();
     xEventGroupWaitBits(wifi_event_group, CONNECTED_BIT, false, true, portMAX_DELAY);
     wifi_init_done = true;
     return ESP_OK;
@@ -124,7 +144,8 @@ bool network_is_alive(void)
 
 
 /**
-@brief Check if Wi-Fi intt has been done
+@brief Check if Wi-Fi intt has been done, or only started by wifi_start(),
+in both cases the radio is on
 
 @return
     - true - yes, init has been done
@@ -132,5 +153,5 @@ bool network_is_alive(void)
 */
 bool network_init_done(void)
 {
-    return wifi_init_done;
+    return wifi_start_done;
 }
@@ -20,6 +20,7 @@ extern "C" {
 extern EventGroupHandle_t wifi_event_group;
 extern const int CONNECTED_BIT;
 
+esp_err_t wifi_start(void);
 esp_err_t wifi_initialize(void);
 bool network_is_alive(void);
 bool network_init_done(void);
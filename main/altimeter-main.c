@@ -18,30 +18,257 @@
 #include "esp_log.h"
 
 #include <time.h>
-#include <sys/time.h>
 #include "esp_sleep.h"
 
 #include "altimeter.h"
+#include "scheduler.h"
 #include "wifi.h"
 #include "weather.h"
 #include "thingspeak.h"
 
+#include "badge_base.h"
+#include "badge_i2c.h"
+#include "badge_mpr121.h"
 #include "badge_power.h"
 #include "badge_leds.h"
+#include "badge_bmp180.h"
 
 static const char* TAG = "Main";
 
 RTC_DATA_ATTR static unsigned long boot_count = 0l;
 
-// Periods in seconds
-#define DEEP_SLEEP_PERIOD                    5
-#define DISPLAY_UPDATE_PERIOD                5
-#define ALTITUDE_UPDATE_PERIOD               5
-#define BATTERY_VOLTAGE_UPDATE_PERIOD        5
-#define HEART_RATE_UPDATE_PERIOD            15
-#define THINGSPEAK_UPDATE_PERIOD            15
-#define REFERENCE_PRESSURE_UPDATE_PERIOD   120
+// Stack of jobs starting Wi-Fi or BT, or posting over HTTP, in their tasks
+#define RADIO_JOB_STACK_SIZE    (8 * 1024)
 
+static void update_display_any(void)
+{
+    update_display(-1);
+}
+
+static void start_wifi(void)
+{
+    wifi_start();
+}
+
+// Altitude is measured as often as vertical speed requires
+static int altitude_period(const scheduler_job_t* job)
+{
+    (void) job;
+    return altitude_sampling_period();
+}
+
+// Jobs back off together with altitude measurement, when it has been flat
+static int follow_activity(const scheduler_job_t* job)
+{
+    int period = altitude_sampling_period();
+    return (period > job->period) ? period : job->period;
+}
+
+// Periodic jobs, by index in the table
+enum {
+    ALTITUDE_JOB,
+    BATTERY_VOLTAGE_JOB,
+    DISPLAY_JOB,
+    THINGSPEAK_JOB,
+    HEART_RATE_JOB,
+    REFERENCE_PRESSURE_JOB,
+};
+
+/* Jobs due in a wake up run concurrently, sensors and display on the APP core,
+ * radio on the PRO core where Wi-Fi and BT tasks run, each as soon as the jobs
+ * it depends on are done. Periods are set in menuconfig.
+ */
+static const scheduler_job_t jobs[] = {
+    [ALTITUDE_JOB] = {
+        .name = "altitude",
+        .run = measure_altitude,
+        // both init MPR121 controlling power of the sensor
+        .after = SCHEDULER_JOB(BATTERY_VOLTAGE_JOB),
+        .core = APP_CPU_NUM,
+        .period = CONFIG_ALTITUDE_UPDATE_PERIOD,
+        .get_period = altitude_period,
+        .last_time = &altitude_update.time,
+    },
+    [BATTERY_VOLTAGE_JOB] = {
+        .name = "battery voltage",
+        .run = measure_battery_voltage,
+        .core = APP_CPU_NUM,
+        .period = CONFIG_BATTERY_VOLTAGE_UPDATE_PERIOD,
+        .get_period = follow_activity,
+        .last_time = &battery_voltage_update.time,
+    },
+    // Display refreshes in background, while network updates are done,
+    // heart rate samples received by then are added to the chart
+    [DISPLAY_JOB] = {
+        .name = "display",
+        .run = update_display_any,
+        .after = SCHEDULER_JOB(ALTITUDE_JOB) | SCHEDULER_JOB(BATTERY_VOLTAGE_JOB),
+        .core = APP_CPU_NUM,
+        .period = CONFIG_DISPLAY_UPDATE_PERIOD,
+        .get_period = follow_activity,
+        .last_time = &display_update.time,
+    },
+    // Wi-Fi connects while altitude is measured and display updated,
+    // battery voltage is measured before Wi-Fi or BLE is on
+    [THINGSPEAK_JOB] = {
+        .name = "ThingSpeak",
+        .start = start_wifi,
+        .start_after = SCHEDULER_JOB(BATTERY_VOLTAGE_JOB),
+        .run = publish_measurements,
+        .after = SCHEDULER_JOB(ALTITUDE_JOB) | SCHEDULER_JOB(BATTERY_VOLTAGE_JOB),
+        .core = PRO_CPU_NUM,
+        .stack_size = RADIO_JOB_STACK_SIZE,
+        .period = CONFIG_THINGSPEAK_UPDATE_PERIOD,
+        .get_period = follow_activity,
+        .last_time = &thingspeak_update.time,
+        .radio = true,
+    },
+    // BLE is not turned on once Wi-Fi is
+    [HEART_RATE_JOB] = {
+        .name = "heart rate",
+        .run = update_heart_rate,
+        .after = SCHEDULER_JOB(BATTERY_VOLTAGE_JOB) | SCHEDULER_JOB(THINGSPEAK_JOB)
+                | SCHEDULER_JOB(REFERENCE_PRESSURE_JOB),
+        .core = PRO_CPU_NUM,
+        .stack_size = RADIO_JOB_STACK_SIZE,
+        .period = CONFIG_HEART_RATE_UPDATE_PERIOD,
+        .get_period = follow_activity,
+        .last_time = &heart_rate_update.time,
+        .radio = true,
+    },
+    // Wi-Fi is initialized by one job at a time
+    [REFERENCE_PRESSURE_JOB] = {
+        .name = "reference pressure",
+        .run = update_reference_pressure,
+        .after = SCHEDULER_JOB(BATTERY_VOLTAGE_JOB) | SCHEDULER_JOB(THINGSPEAK_JOB),
+        .core = PRO_CPU_NUM,
+        .stack_size = RADIO_JOB_STACK_SIZE,
+        .period = CONFIG_REFERENCE_PRESSURE_UPDATE_PERIOD,
+        .get_period = follow_activity,
+        .last_time = &reference_pressure_update.time,
+        .radio = true,
+    },
+};
+
+
+static void log_init_error(const char* name, esp_err_t err)
+{
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize %s, error: %d", name, err);
+    }
+}
+
+static void init_gpio_interrupts(void)
+{
+    log_init_error("GPIO interrupts", badge_base_init());
+}
+
+static void init_i2c(void)
+{
+    log_init_error("I2C", badge_i2c_init());
+}
+
+static void init_mpr121(void)
+{
+    log_init_error("MPR121", badge_mpr121_init());
+}
+
+static void init_power(void)
+{
+    log_init_error("power", badge_power_init());
+}
+
+static void init_bmp180(void)
+{
+    log_init_error("BMP180", badge_bmp180_init());
+}
+
+// Steps of the first boot, by index in the table
+enum {
+    GPIO_INTERRUPTS_INIT,
+    I2C_INIT,
+    MPR121_INIT,
+    POWER_INIT,
+    BATTERY_VOLTAGE_INIT,
+    BMP180_INIT,
+    WELCOME_SCREEN_INIT,
+    WIFI_INIT,
+    REFERENCE_PRESSURE_INIT,
+    ALTITUDE_INIT,
+};
+
+/* The first boot runs steps concurrently, each as soon as the steps it depends on
+ * are done, so the welcome screen refreshes while Wi-Fi connects and weather
+ * data is retrieved. Each init function may be called again by later steps,
+ * these are ordered not to run it twice at the same time.
+ */
+static const scheduler_job_t init_steps[] = {
+    // interrupt service used by the display and MPR121
+    [GPIO_INTERRUPTS_INIT] = {
+        .name = "GPIO interrupts init",
+        .run = init_gpio_interrupts,
+        .core = APP_CPU_NUM,
+    },
+    [I2C_INIT] = {
+        .name = "I2C init",
+        .run = init_i2c,
+        .core = APP_CPU_NUM,
+    },
+    [MPR121_INIT] = {
+        .name = "MPR121 init",
+        .run = init_mpr121,
+        .after = SCHEDULER_JOB(GPIO_INTERRUPTS_INIT) | SCHEDULER_JOB(I2C_INIT),
+        .core = APP_CPU_NUM,
+    },
+    // charge status and power of the sensors are pins of MPR121
+    [POWER_INIT] = {
+        .name = "power init",
+        .run = init_power,
+        .after = SCHEDULER_JOB(MPR121_INIT),
+        .core = APP_CPU_NUM,
+    },
+    // before Wi-Fi is on
+    [BATTERY_VOLTAGE_INIT] = {
+        .name = "battery voltage",
+        .run = measure_battery_voltage,
+        .after = SCHEDULER_JOB(POWER_INIT),
+        .core = APP_CPU_NUM,
+    },
+    [BMP180_INIT] = {
+        .name = "BMP180 init",
+        .run = init_bmp180,
+        .after = SCHEDULER_JOB(POWER_INIT),
+        .core = APP_CPU_NUM,
+    },
+    [WELCOME_SCREEN_INIT] = {
+        .name = "welcome screen",
+        .run = show_welcome_screen,
+        .after = SCHEDULER_JOB(GPIO_INTERRUPTS_INIT),
+        .core = APP_CPU_NUM,
+    },
+    [WIFI_INIT] = {
+        .name = "Wi-Fi init",
+        .run = start_wifi,
+        .after = SCHEDULER_JOB(BATTERY_VOLTAGE_INIT),
+        .core = PRO_CPU_NUM,
+        .stack_size = RADIO_JOB_STACK_SIZE,
+    },
+    // waits for the connection, then for weather data
+    [REFERENCE_PRESSURE_INIT] = {
+        .name = "reference pressure",
+        .run = update_reference_pressure,
+        .after = SCHEDULER_JOB(WIFI_INIT),
+        .core = PRO_CPU_NUM,
+        .stack_size = RADIO_JOB_STACK_SIZE,
+    },
+    // altitude is measured against the reference pressure
+    [ALTITUDE_INIT] = {
+        .name = "altitude init",
+        .run = initialize_altitude_measurement,
+        .after = SCHEDULER_JOB(BMP180_INIT) | SCHEDULER_JOB(REFERENCE_PRESSURE_INIT),
+        .core = APP_CPU_NUM,
+    },
+};
 
 void app_main()
 {
@@ -52,10 +279,7 @@ void app_main()
         ESP_LOGI(TAG, "Wakeup by timer");
     } else {
         ESP_LOGI(TAG, "First time boot");
-        show_welcome_screen();
-        update_reference_pressure();
-        initialize_altitude_measurement();
-        measure_battery_voltage();
+        scheduler_run_all(init_steps, sizeof(init_steps) / sizeof(init_steps[0]));
     }
 
     ESP_LOGI(TAG, "Module boot count: %lu", boot_count++);
@@ -69,52 +293,34 @@ void app_main()
     }
     xTaskCreate(&leds_task, "leds_task", 4 * 1024, NULL, 5, NULL);
 
+    scheduler_start(jobs, sizeof(jobs) / sizeof(jobs[0]));
+    int64_t sleep_us;
+    bool radio_used = false;
     while(1) {
-        struct timeval module_time;
-        gettimeofday(&module_time, NULL);
-        ESP_LOGI(TAG, "Module time %lu s", module_time.tv_sec);
-
-        // Altitude Measurement
-        if (module_time.tv_sec > altitude_update.time + ALTITUDE_UPDATE_PERIOD) {
-            measure_altitude();
-        }
-
-        // Measure battery voltage before Wi-Fi or BLE is on
-        if (module_time.tv_sec > battery_voltage_update.time + BATTERY_VOLTAGE_UPDATE_PERIOD) {
-            measure_battery_voltage();
-        }
-
-        // ThingSpeak Update
-        if (module_time.tv_sec > thingspeak_update.time + THINGSPEAK_UPDATE_PERIOD) {
-            publish_measurements();
-        }
-
-        // Heart Rate Update
-        if (module_time.tv_sec > heart_rate_update.time + HEART_RATE_UPDATE_PERIOD) {
-            update_heart_rate();
-        }
-
-        // Reference Pressure Update
-        if (module_time.tv_sec > reference_pressure_update.time + REFERENCE_PRESSURE_UPDATE_PERIOD) {
-            update_reference_pressure();
-        }
-
-        // Update Screen
-        if (module_time.tv_sec > display_update.time + DISPLAY_UPDATE_PERIOD) {
-            update_display(-1);
-        }
+        radio_used |= scheduler_run_due();
 
         // Handle Touch Pad Events
         //
         // ToDo: Perform the action above
         //
-        break;
+
+        // Jobs that fell due while running the others are run without sleeping
+        sleep_us = scheduler_sleep_us();
+        if (sleep_us > 0) {
+            break;
+        }
     }
 
+    // Wait for display refresh, in light sleep if radio has not been used,
+    // the display is put to sleep only now, as jobs run again above may update it
+    finish_display_update(radio_used == false);
+    // a job falling due while waiting wakes up the module at once
+    sleep_us = scheduler_sleep_us();
+
     //
     // ToDo: Introduce wakeup from touch
     //
     badge_power_leds_disable();
-    ESP_LOGI(TAG, "Entering deep sleep for %d seconds", DEEP_SLEEP_PERIOD);
-    esp_deep_sleep(1000000LL * DEEP_SLEEP_PERIOD);
+    ESP_LOGI(TAG, "Entering deep sleep for %lld ms", sleep_us / 1000);
+    esp_deep_sleep(sleep_us);
 }
@@ -0,0 +1,199 @@
+/*
+ scheduler.c - Periodic jobs run in deep sleep wake ups by their deadlines
+
+ This file is part of the ESP32 Everest Run project
+ https://github.com/krzychb/esp32-everest-run
+
+ Copyright (c) 2016 Krzysztof Budzynski <krzychb@gazeta.pl>
+ This work is licensed under the Apache License, Version 2.0, January 2004
+ See the file LICENSE for details.
+*/
+
+#include <stdio.h>
+#include <sys/time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "sdkconfig.h"
+
+#include "scheduler.h"
+
+static const char* TAG = "Scheduler";
+
+// Deadlines in microseconds of module time, by job index
+RTC_DATA_ATTR static int64_t job_deadline[SCHEDULER_MAX_JOBS];
+// Deadlines of the last runs, a period before the deadlines
+RTC_DATA_ATTR static int64_t job_last_deadline[SCHEDULER_MAX_JOBS];
+// Job indexes ordered by deadline, the earliest first
+RTC_DATA_ATTR static uint8_t job_queue[SCHEDULER_MAX_JOBS];
+// Number of jobs queued, 0 in the first boot
+RTC_DATA_ATTR static int job_count = 0;
+
+static const scheduler_job_t* job_table;
+
+// Jobs run by tasks, bits of those due in this run, and of those that finished
+static const scheduler_job_t* run_table;
+static uint32_t jobs_due;
+static EventGroupHandle_t jobs_done;
+
+static int64_t module_time_us(void)
+{
+    struct timeval module_time;
+    gettimeofday(&module_time, NULL);
+    return (int64_t) module_time.tv_sec * 1000000LL + module_time.tv_usec;
+}
+
+static int64_t job_period_us(const scheduler_job_t* job)
+{
+    int period = (job->get_period != NULL) ? job->get_period(job) : 0;
+    return ((period > 0) ? period : job->period) * 1000000LL;
+}
+
+// Put the job in the queue, after jobs with the same or earlier deadline
+static void queue_job(int queued, uint8_t job)
+{
+    int i = queued;
+    while (i > 0 && job_deadline[job_queue[i - 1]] > job_deadline[job]) {
+        job_queue[i] = job_queue[i - 1];
+        i--;
+    }
+    job_queue[i] = job;
+}
+
+// Wait for the jobs that are due, jobs not due are not waited for
+static void wait_for_jobs(uint32_t jobs)
+{
+    jobs &= jobs_due;
+    if (jobs != 0) {
+        xEventGroupWaitBits(jobs_done, jobs, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+}
+
+static void job_task(void *pvParameter)
+{
+    int index = (intptr_t) pvParameter;
+    const scheduler_job_t* job = &run_table[index];
+
+    if (job->start != NULL) {
+        wait_for_jobs(job->start_after);
+        job->start();
+    }
+    wait_for_jobs(job->after);
+    int64_t run_time = module_time_us();
+    job->run();
+    ESP_LOGI(TAG, "Finished %s in %lld ms, %u bytes of stack left", job->name, (module_time_us() - run_time) / 1000,
+            (unsigned) uxTaskGetStackHighWaterMark(NULL));
+    xEventGroupSetBits(jobs_done, SCHEDULER_JOB(index));
+    vTaskDelete(NULL);
+}
+
+// Run the jobs with bits in 'due' by tasks, and wait until all are done
+static void run_jobs(const scheduler_job_t* jobs, uint32_t due)
+{
+    if (jobs_done == NULL) {
+        jobs_done = xEventGroupCreate();
+    }
+    run_table = jobs;
+    jobs_due = due;
+    xEventGroupClearBits(jobs_done, SCHEDULER_JOB(SCHEDULER_MAX_TASKS) - 1);
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        if ((due & SCHEDULER_JOB(i)) == 0) {
+            continue;
+        }
+#if CONFIG_FREERTOS_UNICORE
+        int core = PRO_CPU_NUM;
+#else
+        int core = jobs[i].core;
+#endif
+        uint32_t stack_size = (jobs[i].stack_size != 0) ? jobs[i].stack_size : SCHEDULER_TASK_STACK_SIZE;
+        if (xTaskCreatePinnedToCore(&job_task, jobs[i].name, stack_size, (void*) (intptr_t) i,
+                SCHEDULER_TASK_PRIORITY, NULL, core) != pdPASS) {
+            // jobs waiting for it are not blocked forever
+            ESP_LOGE(TAG, "Failed to create task of %s, it is skipped", jobs[i].name);
+            xEventGroupSetBits(jobs_done, SCHEDULER_JOB(i));
+        }
+    }
+    // it takes as long as the slowest chain of jobs
+    wait_for_jobs(due);
+}
+
+void scheduler_start(const scheduler_job_t* jobs, int count)
+{
+    if (count > SCHEDULER_MAX_JOBS) {
+        ESP_LOGE(TAG, "%d jobs, only %d are scheduled", count, SCHEDULER_MAX_JOBS);
+        count = SCHEDULER_MAX_JOBS;
+    }
+    job_table = jobs;
+    if (job_count == count) {
+        return;
+    }
+    int64_t now = module_time_us();
+    for (int i = 0; i < count; i++) {
+        unsigned long last_time = *jobs[i].last_time;
+        int64_t period = job_period_us(&jobs[i]);
+        job_deadline[i] = (last_time == 0) ? now : (int64_t) last_time * 1000000LL + period;
+        job_last_deadline[i] = job_deadline[i] - period;
+        queue_job(i, i);
+    }
+    job_count = count;
+}
+
+bool scheduler_run_due(void)
+{
+    bool radio_used = false;
+    int64_t now = module_time_us();
+    int64_t window_end = now + CONFIG_SCHEDULER_COALESCE_WINDOW * 1000000LL;
+    int due_count = 0;
+
+    ESP_LOGI(TAG, "Module time %lld ms", now / 1000);
+    uint32_t due = 0;
+    while (due_count < job_count && job_deadline[job_queue[due_count]] <= window_end) {
+        due |= SCHEDULER_JOB(job_queue[due_count]);
+        due_count++;
+    }
+    for (int i = 0; i < job_count; i++) {
+        if (due & SCHEDULER_JOB(i)) {
+            ESP_LOGI(TAG, "Run %s, due in %lld ms", job_table[i].name, (job_deadline[i] - now) / 1000);
+            radio_used |= job_table[i].radio;
+        }
+    }
+    run_jobs(job_table, due);
+    // periods may change with any job run, so all jobs are queued again
+    now = module_time_us();
+    for (int i = 0; i < job_count; i++) {
+        int64_t period = job_period_us(&job_table[i]);
+        if (due & SCHEDULER_JOB(i)) {
+            // keep the cadence of the job, unless it fell behind by a period
+            job_last_deadline[i] = (job_deadline[i] + period <= now) ? now : job_deadline[i];
+        }
+        job_deadline[i] = job_last_deadline[i] + period;
+        if (job_deadline[i] < now) {
+            job_deadline[i] = now;
+        }
+        queue_job(i, i);
+    }
+    return radio_used;
+}
+
+void scheduler_run_all(const scheduler_job_t* jobs, int count)
+{
+    if (count > SCHEDULER_MAX_TASKS) {
+        ESP_LOGE(TAG, "%d jobs, only %d are run", count, SCHEDULER_MAX_TASKS);
+        count = SCHEDULER_MAX_TASKS;
+    }
+    int64_t run_time = module_time_us();
+    run_jobs(jobs, SCHEDULER_JOB(count) - 1);
+    ESP_LOGI(TAG, "Finished all %d jobs in %lld ms", count, (module_time_us() - run_time) / 1000);
+}
+
+int64_t scheduler_sleep_us(void)
+{
+    if (job_count == 0) {
+        return 0;
+    }
+    int64_t sleep_us = job_deadline[job_queue[0]] - module_time_us();
+    return (sleep_us > 0) ? sleep_us : 0;
+}
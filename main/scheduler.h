@@ -0,0 +1,103 @@
+/*
+ scheduler.h - Periodic jobs run in deep sleep wake ups by their deadlines
+
+ This file is part of the ESP32 Everest Run project
+ https://github.com/krzychb/esp32-everest-run
+
+ Copyright (c) 2016 Krzysztof Budzynski <krzychb@gazeta.pl>
+ This work is licensed under the Apache License, Version 2.0, January 2004
+ See the file LICENSE for details.
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum number of jobs, deadlines of which are kept in RTC memory
+#define SCHEDULER_MAX_JOBS  8
+
+// Maximum number of jobs run together, by bits of an event group
+#define SCHEDULER_MAX_TASKS 24
+
+// Bit of the job with the index in the table, for 'start_after' and 'after'
+#define SCHEDULER_JOB(index)    (1u << (index))
+
+// Stack size of tasks running the jobs, unless set by the job, and their priority
+#define SCHEDULER_TASK_STACK_SIZE   (4 * 1024)
+#define SCHEDULER_TASK_PRIORITY     5
+
+typedef struct scheduler_job scheduler_job_t;
+
+struct scheduler_job {
+    const char* name;
+    void (*run)(void);
+    // Started without waiting for the run of other jobs, e.g. to connect Wi-Fi, may be NULL
+    void (*start)(void);
+    // Jobs that finish before start(), if due in the same wake up
+    uint32_t start_after;
+    // Jobs that finish before run(), if due in the same wake up, e.g. the ones measuring data the job uses
+    uint32_t after;
+    // Core the job is run on, PRO_CPU_NUM or APP_CPU_NUM
+    int core;
+    // Stack size in bytes of the task running the job, SCHEDULER_TASK_STACK_SIZE if 0
+    // The stack left unused is logged when the job finishes.
+    uint32_t stack_size;
+    // Period in seconds
+    int period;
+    // Period in seconds at the time, e.g. adapted to activity, 'period' if NULL or it returns 0
+    int (*get_period)(const scheduler_job_t* job);
+    // Time in seconds of the last successful run, 0 if none, updated by the job
+    const unsigned long* last_time;
+    // The job uses Wi-Fi or BLE
+    bool radio;
+};
+
+/**
+ * @brief   Give the table of jobs to the scheduler, in each boot
+ *          Deadlines kept in RTC memory are used after wake up from deep sleep.
+ *          In the first boot, or if the number of jobs changed, a job is queued
+ *          a period after its last successful run, or at once if it has not run.
+ *          Jobs that are due together are run concurrently by their dependencies.
+ * @param   jobs  table of jobs, in use by the scheduler until deep sleep
+ * @param   count number of jobs, up to SCHEDULER_MAX_JOBS
+ */
+void scheduler_start(const scheduler_job_t* jobs, int count);
+
+/**
+ * @brief   Run jobs that are due, and those due within the coalescing window,
+ *          CONFIG_SCHEDULER_COALESCE_WINDOW, then queue them a period later
+ *          Each job is run by a task on its core, as soon as the jobs it runs after
+ *          have finished. Dependencies must not form a cycle. Returns when all are done.
+ *          A job the task of which cannot be created is skipped, as if it was done.
+ *          Jobs not run are queued anew if their periods changed, a period after
+ *          their last deadlines, or at once if that is in the past.
+ * @return  true if any of the jobs run uses radio
+ */
+bool scheduler_run_due(void);
+
+/**
+ * @brief   Run all jobs of the table once, concurrently by their dependencies,
+ *          e.g. initialization in the first boot, their periods are not used
+ *          Returns when all are done.
+ * @param   jobs  table of jobs
+ * @param   count number of jobs, up to SCHEDULER_MAX_TASKS
+ */
+void scheduler_run_all(const scheduler_job_t* jobs, int count);
+
+/**
+ * @brief   Time until the next deadline
+ * @return  microseconds, 0 if a job is already due
+ */
+int64_t scheduler_sleep_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif